@@ -0,0 +1,89 @@
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <vector>
+
+#include "occa.hpp"
+
+// Hash used for cache names before occa::hasher, kept for comparison
+std::string oldFnv(const std::string &saltedString){
+  const int len = saltedString.size();
+  std::stringstream ss;
+
+  int h[8] = {101527, 101531,
+              101533, 101537,
+              101561, 101573,
+              101581, 101599};
+
+  const int p[8] = {102679, 102701,
+                    102761, 102763,
+                    102769, 102793,
+                    102797, 102811};
+
+  for(int c = 0; c < len; ++c)
+    for(int i = 0; i < 8; ++i)
+      h[i] = (h[i] * p[i]) ^ saltedString[c];
+
+  for(int i = 0; i < 8; ++i)
+    ss <<  std::hex << h[i];
+
+  return ss.str();
+}
+
+int main(int argc, char **argv){
+  const int sizes[4] = {1 << 10, 1 << 16, 1 << 20, 1 << 26};
+
+  std::cout << std::setw(12) << "Bytes"
+            << std::setw(16) << "hasher (GB/s)"
+            << std::setw(16) << "fnv (GB/s)" << '\n';
+
+  for(int s = 0; s < 4; ++s){
+    std::string buffer(sizes[s], ' ');
+
+    for(int i = 0; i < sizes[s]; ++i)
+      buffer[i] = (char) (i * 2654435761u >> 24);
+
+    // Repeat small inputs so each timing covers ~256 MB
+    const int reps = 1 + ((1 << 28) / sizes[s]);
+    const int fnvReps = 1 + reps/16;
+
+    double start = occa::currentTime();
+
+    for(int r = 0; r < reps; ++r)
+      occa::hashString(buffer);
+
+    const double hashTime = (occa::currentTime() - start) / reps;
+
+    start = occa::currentTime();
+
+    for(int r = 0; r < fnvReps; ++r)
+      oldFnv(buffer);
+
+    const double fnvTime = (occa::currentTime() - start) / fnvReps;
+
+    std::cout << std::setw(12) << sizes[s]
+              << std::setw(16) << (sizes[s] / hashTime) * 1.0e-9
+              << std::setw(16) << (sizes[s] / fnvTime)  * 1.0e-9 << '\n';
+  }
+
+  // Cache lookup on a large generated kernel, including file I/O
+  const int kernels = 20000;
+  std::ofstream fs("benchmarkKernel.occa");
+
+  for(int k = 0; k < kernels; ++k)
+    fs << "occaKernel void kernel" << k << "(occaKernelInfoArg, occaPointer float *a){\n"
+       << "  occaOuterFor0{ occaInnerFor0{ a[occaGlobalId0] += " << k << "; } }\n"
+       << "}\n";
+
+  fs.close();
+
+  const double start = occa::currentTime();
+  const std::string cachedName = occa::getCachedName("benchmarkKernel.occa", "salt");
+  const double nameTime = occa::currentTime() - start;
+
+  std::cout << "\ngetCachedName on a " << kernels << "-kernel file: "
+            << nameTime * 1.0e3 << " ms\n"
+            << "  " << cachedName << '\n';
+
+  return 0;
+}
@@ -0,0 +1,110 @@
+#include <iostream>
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+#include "occa.hpp"
+
+// Checks memory::fill, gather and scatter against host loops
+//   ./main [mode] [threads], runs OpenMP and Pthreads without arguments
+
+int check(const std::string &name, const bool passed){
+  std::cout << "  " << name << (passed ? ": passed\n" : ": FAILED\n");
+  return (passed ? 0 : 1);
+}
+
+int testMode(const std::string &mode, const int threads){
+  std::cout << mode << ":\n";
+
+  occa::device device;
+  device.setup(mode, threads, 0);
+
+  const int bytes   = (1 << 20) + 13;
+  const int offset  = 7;
+  const int entries = 1000;
+
+  std::vector<char> result(bytes), expected(bytes);
+
+  occa::memory o_a = device.malloc(bytes);
+
+  int failures = 0;
+
+  //---[ Fill ]-----------------------
+  const char patterns[3][12] = {{'x'},
+                                {1, 2, 3, 4},
+                                {'o', 'c', 'c', 'a', '-', 'f', 'i', 'l', 'l', '-', '1', '2'}};
+  const int patternBytes[3]  = {1, 4, 12};
+
+  for(int p = 0; p < 3; ++p){
+    ::memset(&(expected[0]), 0, bytes);
+
+    for(int i = offset; i < bytes; ++i)
+      expected[i] = patterns[p][(i - offset) % patternBytes[p]];
+
+    o_a.copyFrom(&(expected[0]), offset);
+    o_a.fill(patterns[p], patternBytes[p], bytes - offset, offset);
+    o_a.copyTo(&(result[0]));
+
+    std::stringstream ss;
+    ss << "fill (" << patternBytes[p] << "-byte pattern)";
+
+    failures += check(ss.str(), result == expected);
+  }
+  //==================================
+
+  //---[ Gather / Scatter ]-----------
+  std::vector<double> src(entries), gathered(entries), scattered(entries);
+  std::vector<int> indices(entries);
+
+  for(int i = 0; i < entries; ++i){
+    src[i]     = 0.5*i;
+    indices[i] = (37*i + 11) % entries; // A permutation, entries is coprime with 37
+  }
+
+  occa::memory o_src     = device.malloc(entries*sizeof(double), &(src[0]));
+  occa::memory o_dest    = device.malloc(entries*sizeof(double));
+  occa::memory o_indices = device.malloc(entries*sizeof(int), &(indices[0]));
+
+  o_src.gather(o_dest, o_indices, sizeof(double), entries);
+  o_dest.copyTo(&(gathered[0]));
+
+  bool passed = true;
+
+  for(int i = 0; i < entries; ++i)
+    passed = passed && (gathered[i] == src[indices[i]]);
+
+  failures += check("gather", passed);
+
+  o_src.scatter(o_dest, o_indices, sizeof(double), entries);
+  o_dest.copyTo(&(scattered[0]));
+
+  passed = true;
+
+  for(int i = 0; i < entries; ++i)
+    passed = passed && (scattered[indices[i]] == src[i]);
+
+  failures += check("scatter", passed);
+  //==================================
+
+  o_a.free();
+  o_src.free();
+  o_dest.free();
+  o_indices.free();
+
+  device.free();
+
+  return failures;
+}
+
+int main(int argc, char **argv){
+  int failures = 0;
+
+  if(1 < argc)
+    failures += testMode(argv[1], (2 < argc) ? atoi(argv[2]) : 4);
+  else{
+    failures += testMode("OpenMP"  , 0);
+    failures += testMode("Pthreads", 4);
+  }
+
+  return (failures ? 1 : 0);
+}
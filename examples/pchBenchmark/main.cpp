@@ -0,0 +1,69 @@
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <stdlib.h>
+#include <time.h>
+
+#include "occa.hpp"
+
+// Cold build time per kernel with and without the precompiled prelude
+int main(int argc, char **argv){
+  const std::string mode = (1 < argc) ? argv[1] : "OpenMP";
+  const int kernels = 8;
+
+  occa::device device;
+  device.setup(mode, 0, 0);
+
+  std::ofstream fs("benchmarkKernel.occa");
+
+  fs << "occaKernel void benchmarkKernel(occaKernelInfoArg, const int occaVariable entries,\n"
+     << "                                occaPointer float *a){\n"
+     << "  occaOuterFor0{ occaInnerFor0{\n"
+     << "    const int i = occaGlobalId0;\n"
+     << "    if(i < entries) a[i] += BENCHMARK_ID;\n"
+     << "  }}\n"
+     << "}\n";
+
+  fs.close();
+
+  // New defines every run keep the kernel builds cold
+  const int runID = (int) (time(NULL) % 100000);
+
+  std::cout << std::setw(10) << "PCH"
+            << std::setw(20) << "First build (s)"
+            << std::setw(20) << "Mean build (s)" << '\n';
+
+  for(int pch = 0; pch < 2; ++pch){
+    setenv("OCCA_PCH", (pch ? "1" : "0"), 1);
+
+    double firstTime = 0, totalTime = 0;
+
+    for(int k = 0; k < kernels; ++k){
+      occa::kernelInfo info;
+      info.addDefine("BENCHMARK_ID", 1000*runID + 100*pch + k);
+
+      const double start = occa::currentTime();
+
+      occa::kernel benchmarkKernel = device.buildKernelFromSource("benchmarkKernel.occa",
+                                                                  "benchmarkKernel",
+                                                                  info);
+
+      const double buildTime = occa::currentTime() - start;
+
+      if(k == 0)
+        firstTime = buildTime;
+      else
+        totalTime += buildTime;
+
+      benchmarkKernel.free();
+    }
+
+    std::cout << std::setw(10) << (pch ? "on" : "off")
+              << std::setw(20) << firstTime
+              << std::setw(20) << totalTime / (kernels - 1) << '\n';
+  }
+
+  device.free();
+
+  return 0;
+}
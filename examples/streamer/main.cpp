@@ -0,0 +1,97 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+#include "occa.hpp"
+
+// Compares occa::streamer results with a single launch over the whole arrays
+//   ./main [mode] [threads], runs OpenMP and Pthreads without arguments
+
+int testMode(const std::string &mode, const int threads){
+  std::cout << mode << ":\n";
+
+  occa::device device;
+  device.setup(mode, threads, 0);
+
+  const int entries  = 1000003;
+  const float alpha  = 0.5;
+  const int inner    = 64;
+
+  std::vector<float> x(entries), y(entries), expected(entries);
+
+  for(int i = 0; i < entries; ++i){
+    x[i] = (i % 17);
+    y[i] = (i % 5);
+  }
+
+  occa::kernel scaleAdd = device.buildKernelFromSource("scaleAdd.occa",
+                                                       "scaleAdd");
+
+  //---[ Single launch ]--------------
+  occa::memory o_x = device.malloc(entries*sizeof(float), &(x[0]));
+  occa::memory o_y = device.malloc(entries*sizeof(float), &(y[0]));
+
+  scaleAdd.setWorkingDims(1, inner, (entries + inner - 1) / inner);
+  scaleAdd(entries, 0, o_x, o_y, alpha);
+
+  o_y.copyTo(&(expected[0]));
+
+  o_x.free();
+  o_y.free();
+  //==================================
+
+  int failures = 0;
+
+  for(int staged = 0; staged < 2; ++staged){
+    // 10 chunks zero-copy, 30 staged through 3 resident slots
+    occa::streamer s(device, scaleAdd, entries * 2 * sizeof(float) / 10);
+
+    s.setInnerDim(inner);
+
+    if(staged)
+      s.disableZeroCopy();
+
+    std::vector<float> result(entries);
+
+    s.addChunkEntriesArg();
+    s.addChunkOffsetArg();
+    s.addInput(&(x[0]), sizeof(float));
+    s.addInOut(&(result[0]), sizeof(float));
+    s.addArgument(alpha);
+
+    // Runs twice, staged slots are reused by the second run
+    for(int run = 0; run < 2; ++run){
+      std::copy(y.begin(), y.end(), result.begin());
+
+      s.run(entries);
+
+      const bool passed = (result == expected);
+
+      std::cout << "  " << (staged ? "staged" : "zero-copy") << ", run " << run
+                << " (" << s.chunkEntries() << " entries per chunk): "
+                << (passed ? "passed\n" : "FAILED\n");
+
+      failures += !passed;
+    }
+
+    s.free();
+  }
+
+  scaleAdd.free();
+  device.free();
+
+  return failures;
+}
+
+int main(int argc, char **argv){
+  int failures = 0;
+
+  if(1 < argc)
+    failures += testMode(argv[1], (2 < argc) ? atoi(argv[2]) : 4);
+  else{
+    failures += testMode("OpenMP"  , 0);
+    failures += testMode("Pthreads", 4);
+  }
+
+  return (failures ? 1 : 0);
+}
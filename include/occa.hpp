@@ -5,7 +5,15 @@
 
 #include "occaDefines.hpp"
 #include "occaTools.hpp"
+#include "occaCompiler.hpp"
+#include "occaBundle.hpp"
+#include "occaCache.hpp"
 #include "occaTimer.hpp"
 #include "occaBase.hpp"
+#include "occaMirror.hpp"
+#include "occaStreamer.hpp"
+#include "occaTuner.hpp"
+#include "occaCapture.hpp"
+#include "occaGraph.hpp"
 
 #endif
@@ -6,6 +6,7 @@
 #include <sstream>
 #include <fstream>
 #include <vector>
+#include <map>
 
 #include <xmmintrin.h>
 #include <string.h>
@@ -78,6 +79,14 @@ namespace occa {
 
   static const uintptr_t useLoopy  = (1 << 0);
   static const uintptr_t useFloopy = (1 << 1);
+
+  // device::mapFile flags, mapReadOnly by default
+  //   Passing 0 maps the file shared and writable
+  static const int mapReadOnly    = (1 << 0);
+  static const int mapCopyOnWrite = (1 << 1);
+  static const int mapSequential  = (1 << 2);
+  static const int mapRandom      = (1 << 3);
+  static const int mapWillNeed    = (1 << 4);
   //==================================
 
   //---[ Mode ]-----------------------
@@ -153,6 +162,7 @@ namespace occa {
   class memory_v;
   template <occa::mode> class memory_t;
   class memory;
+  class mirror;
 
   class device_v;
   template <occa::mode> class device_t;
@@ -325,19 +335,26 @@ namespace occa {
     uintptr_t size;
     bool pointer;
 
-    inline kernelArg(){
+    memory_v *mHandle; // Set for occa::memory arguments
+
+    inline kernelArg() :
+      size(0),
+      pointer(false),
+      mHandle(NULL) {
       arg.void_ = NULL;
     }
 
     inline kernelArg(kernelArg_t arg_, uintptr_t size_, bool pointer_) :
       size(size_),
-      pointer(pointer_) {
+      pointer(pointer_),
+      mHandle(NULL) {
       arg.void_ = arg_.void_;
     }
 
     inline kernelArg(const kernelArg &k) :
       size(k.size),
-      pointer(k.pointer) {
+      pointer(k.pointer),
+      mHandle(k.mHandle) {
       arg.void_ = k.arg.void_;
     }
 
@@ -345,6 +362,7 @@ namespace occa {
       arg.void_ = k.arg.void_;
       size      = k.size;
       pointer   = k.pointer;
+      mHandle   = k.mHandle;
 
       return *this;
     }
@@ -373,6 +391,7 @@ namespace occa {
       size = sizeof(void*);
 
       pointer = true;
+      mHandle = NULL;
     }
 
     inline void* data() const {
@@ -389,20 +408,97 @@ namespace occa {
     CUevent cuEvent;
 #endif
   };
+
+  // Page-locked host allocation from device::mallocHost
+  class pinnedBuffer {
+  public:
+    void *ptr;
+    uintptr_t bytes;
+
+    void *handle; // Mode backing object, if any
+
+    inline pinnedBuffer() :
+      ptr(NULL),
+      bytes(0),
+      handle(NULL) {}
+  };
   //==================================
 
 
   //---[ Kernel ]---------------------
+  // Returns true if [kHandle] came from the in-process kernel cache
+  bool releaseCachedKernel(kernel_v *kHandle);
+
+  // Pending device::buildKernelFromSourceAsync (or Lazy) build
+  class kernelBuild;
+
+  // Variants of a kernel built with kernelInfo::specializeArgument
+  class kernelVariants;
+
+  class tuningSpace;
+  class tuningRecord;
+
+  // Profile of an OCCA_PGO build still being collected
+  class kernelProfile;
+
+  // Exported by OCCA_PGO instrumented binaries, writes their profile
+  static const char profileDumpName[] = "occaDumpProfile";
+
+  // Launch saved by OCCA_CAPTURE
+  class kernelCapture;
+
+  // Launches and copies recorded by device::beginCapture
+  class graph_v;
+  class kernelGraph;
+
+  // Both ends of occa-compile-server
+  class compileServer;
+
+  void freeKernelVariants(kernel_v *kHandle);
+  void freeKernelProfile(kernel_v *kHandle);
+  void freeKernelCapture(kernel_v *kHandle);
+
+  // The variant (or [kHandle]) used by the last launch
+  kernel_v* lastLaunchedHandle(kernel_v *kHandle);
+
+  // Waits for [kHandle]'s asynchronous build, returns false if it failed
+  //   (a failed build is kept until [discard]ed by kernel::free)
+  bool finishKernelBuild(kernel_v *kHandle, const bool discard = false);
+
   class kernel_v {
     template <occa::mode> friend class occa::kernel_t;
     template <occa::mode> friend class occa::device_t;
     friend class occa::kernel;
     friend class occa::device;
+    friend class occa::kernelBuild;
+    friend bool occa::releaseCachedKernel(kernel_v *kHandle);
+    friend bool occa::finishKernelBuild(kernel_v *kHandle, const bool discard);
+    friend class occa::kernelVariants;
+    friend void occa::freeKernelVariants(kernel_v *kHandle);
+    friend kernel_v* occa::lastLaunchedHandle(kernel_v *kHandle);
+    friend class occa::kernelProfile;
+    friend void occa::freeKernelProfile(kernel_v *kHandle);
+    friend class occa::kernelCapture;
+    friend void occa::freeKernelCapture(kernel_v *kHandle);
+    friend class occa::graph_v;
+    friend class occa::compileServer;
 
   private:
     void* data;
     occa::device *dev;
 
+    kernelBuild *build; // Set while an asynchronous build is in flight
+
+    kernelVariants *variants; // Set for kernels with specialized arguments
+
+    kernelProfile *profile; // Set while an instrumented build runs
+
+    kernelCapture *capture; // Set until the launch picked by OCCA_CAPTURE
+
+    // Inner dimensions picked by device::autotuneKernel
+    int tunedDims;
+    dim tunedInner;
+
     std::string functionName;
 
     int dims;
@@ -413,6 +509,13 @@ namespace occa {
     void *startTime, *endTime;
 
   public:
+    inline kernel_v() :
+      build(NULL),
+      variants(NULL),
+      profile(NULL),
+      capture(NULL),
+      tunedDims(0) {}
+
     virtual inline ~kernel_v(){}
 
     virtual kernel_v* buildFromSource(const std::string &filename,
@@ -428,6 +531,10 @@ namespace occa {
 
     virtual double timeTaken() = 0;
 
+    // Writes the profile of an OCCA_PGO instrumented build without unloading it,
+    //   false if the binary has no profileDumpName function
+    virtual bool dumpProfile() = 0;
+
     virtual void free() = 0;
   };
 
@@ -457,11 +564,14 @@ namespace occa {
 
     double timeTaken();
 
+    bool dumpProfile();
+
     void free();
   };
 
   class kernel {
     friend class occa::device;
+    friend void occa::freeKernelVariants(kernel_v *kHandle);
 
   private:
     occa::mode mode_;
@@ -472,6 +582,15 @@ namespace occa {
     int argumentCount;
     kernelArg arguments[25];
 
+    // Waits for the build and picks the variant specialized for [args]
+    kernel_v* variantHandle(const kernelArg *args,
+                            const int argCount);
+
+    // The handle to launch, counts launches of profiled and captured kernels
+    //   NULL if the launch was recorded into a graph instead
+    kernel_v* launchHandle(const kernelArg *args,
+                           const int argCount);
+
   public:
     kernel();
 
@@ -487,8 +606,20 @@ namespace occa {
     kernel& buildFromBinary(const std::string &filename,
                             const std::string &functionName_);
 
+    // Blocks until an asynchronous build is done (launches wait implicitly)
+    //   Lazy builds are not ready until they are launched, waited on or prefetched
+    bool isReady();
+    void wait();
+
+    // Starts compiling a lazy build in the background, it does nothing otherwise
+    void prefetch();
+
+    // The tuned inner size if the kernel was autotuned
     int preferredDimSize();
 
+    // Inner dimensions found by device::autotuneKernel, returns 0 if untuned
+    int tunedInnerDims(dim &inner);
+
     void setWorkingDims(int dims, dim inner, dim outer);
 
     void clearArgumentList();
@@ -558,6 +689,9 @@ namespace occa {
     friend class occa::memory;
     friend class occa::device;
     friend class occa::kernelArg;
+    friend class occa::mirror;
+    friend class occa::kernelCapture;
+    friend class occa::graph_v;
 
   private:
     void *handle;
@@ -565,7 +699,26 @@ namespace occa {
 
     uintptr_t size;
 
+    // Page-aligned file mapping behind [handle], set by device::mapFile
+    void *mappedPtr;
+    uintptr_t mappedBytes;
+
+    // Host-staged fallbacks for modes without device-side index kernels
+    void hostGather(memory_v *dest,
+                    const memory_v *indices,
+                    const uintptr_t entryBytes,
+                    const uintptr_t entries);
+
+    void hostScatter(memory_v *dest,
+                     const memory_v *indices,
+                     const uintptr_t entryBytes,
+                     const uintptr_t entries);
+
   public:
+    inline memory_v() :
+      mappedPtr(NULL),
+      mappedBytes(0) {}
+
     virtual inline ~memory_v(){}
 
     virtual void copyFrom(const void *source,
@@ -604,6 +757,21 @@ namespace occa {
                              const uintptr_t destOffset = 0,
                              const uintptr_t srcOffset = 0) = 0;
 
+    virtual void fill(const void *pattern,
+                      const uintptr_t patternBytes,
+                      const uintptr_t bytes = 0,
+                      const uintptr_t offset = 0) = 0;
+
+    virtual void gather(memory_v *dest,
+                        const memory_v *indices,
+                        const uintptr_t entryBytes,
+                        const uintptr_t entries) = 0;
+
+    virtual void scatter(memory_v *dest,
+                         const memory_v *indices,
+                         const uintptr_t entryBytes,
+                         const uintptr_t entries) = 0;
+
     virtual void free() = 0;
   };
 
@@ -655,6 +823,21 @@ namespace occa {
                      const uintptr_t destOffset = 0,
                      const uintptr_t srcOffset = 0);
 
+    void fill(const void *pattern,
+              const uintptr_t patternBytes,
+              const uintptr_t bytes = 0,
+              const uintptr_t offset = 0);
+
+    void gather(memory_v *dest,
+                const memory_v *indices,
+                const uintptr_t entryBytes,
+                const uintptr_t entries);
+
+    void scatter(memory_v *dest,
+                 const memory_v *indices,
+                 const uintptr_t entryBytes,
+                 const uintptr_t entries);
+
     void free();
   };
 
@@ -662,6 +845,7 @@ namespace occa {
   class memory {
     friend class occa::device;
     friend class occa::kernelArg;
+    friend class occa::mirror;
 
   private:
     occa::mode mode_;
@@ -720,6 +904,24 @@ namespace occa {
                      const uintptr_t destOffset = 0,
                      const uintptr_t srcOffset = 0);
 
+    // Repeats [pattern] over [bytes] (0 = whole buffer)
+    void fill(const void *pattern,
+              const uintptr_t patternBytes,
+              const uintptr_t bytes = 0,
+              const uintptr_t offset = 0);
+
+    // dest[i] = this[indices[i]], indices are device-side ints
+    void gather(memory &dest,
+                const memory &indices,
+                const uintptr_t entryBytes,
+                const uintptr_t entries);
+
+    // dest[indices[i]] = this[i]
+    void scatter(memory &dest,
+                 const memory &indices,
+                 const uintptr_t entryBytes,
+                 const uintptr_t entries);
+
     void swap(memory &m);
 
     void free();
@@ -731,6 +933,7 @@ namespace occa {
     size = sizeof(void*);
 
     pointer = true;
+    mHandle = m.mHandle;
   }
   //==================================
 
@@ -739,22 +942,43 @@ namespace occa {
   template <occa::mode>
   std::vector<occa::deviceInfo> availableDevices();
 
+  // The host CPU for Pthreads and OpenMP, labeled with its ISA and the
+  //   flags kernels are compiled with
+  occa::deviceInfo hostDeviceInfo(const occa::mode m,
+                                  const std::string &compilerFlags);
+
   class device_v {
     template <occa::mode> friend class occa::device_t;
     template <occa::mode> friend class occa::kernel_t;
+    template <occa::mode> friend class occa::memory_t;
 
     friend class occa::device;
     friend class occa::memory;
+    friend class occa::kernelProfile;
+    friend class occa::graph_v;
 
   private:
     void* data;
     occa::device *dev;
 
+    graph_v *graph; // Set between device::beginCapture and endCapture
+
     std::string compiler, compilerEnvScript, compilerFlags;
 
     int simdWidth_;
 
+    // Arguments given to setup, they tell devices apart in tuning records
+    int setupArgs[2];
+
+    // Never reused (unlike the device_v's address), keys the in-process kernel cache
+    uintptr_t cacheId;
+
     uintptr_t memoryAllocated;
+    uintptr_t hostMemoryAllocated;
+
+    // Only for freeHost and device::free, copies don't look pointers up:
+    //   the driver already recognizes page-locked memory it handed out
+    std::map<char*, pinnedBuffer> pinnedBuffers;
 
   public:
     virtual inline ~device_v(){}
@@ -789,9 +1013,19 @@ namespace occa {
     virtual memory_v* malloc(const uintptr_t bytes,
                              void* source) = 0;
 
+    virtual memory_v* mapFile(const std::string &filename,
+                              const uintptr_t offset,
+                              const uintptr_t bytes,
+                              const int flags) = 0;
+
+    virtual pinnedBuffer mallocHost(const uintptr_t bytes) = 0;
+    virtual void freeHost(pinnedBuffer &buffer) = 0;
+
     virtual void free() = 0;
 
     virtual int simdWidth() = 0;
+
+    virtual void runGraph(graph_v &graph) = 0;
   };
 
   template <occa::mode mode>
@@ -837,9 +1071,19 @@ namespace occa {
     memory_v* malloc(const uintptr_t bytes,
                      void *source);
 
+    memory_v* mapFile(const std::string &filename,
+                      const uintptr_t offset,
+                      const uintptr_t bytes,
+                      const int flags);
+
+    pinnedBuffer mallocHost(const uintptr_t bytes);
+    void freeHost(pinnedBuffer &buffer);
+
     void free();
 
     int simdWidth();
+
+    void runGraph(graph_v &graph);
   };
 
   class device {
@@ -848,6 +1092,10 @@ namespace occa {
     template <occa::mode> friend class occa::device_t;
 
     friend class occa::memory;
+    friend class occa::kernelBuild;
+    friend class occa::kernelProfile;
+    friend class occa::graph_v;
+    friend class occa::compileServer;
 
   private:
     occa::mode mode_;
@@ -858,6 +1106,29 @@ namespace occa {
     stream currentStream;
     std::vector<stream> streams;
 
+    kernel_v* cloneKernelHandle(kernel_v *kHandle_);
+
+    std::string cachedKernelKey(const std::string &filename,
+                                const std::string &functionName,
+                                const kernelInfo &info_);
+
+    // Tuning record of [functionName] built with [info_] on this device and machine
+    std::string tuningRecordName(const std::string &filename,
+                                 const std::string &functionName,
+                                 const kernelInfo &info_);
+
+    // Loads the winner of [functionName] into [tuning], false if it was never tuned
+    bool findTuningRecord(const std::string &filename,
+                          const std::string &functionName,
+                          const kernelInfo &info_,
+                          tuningRecord &tuning);
+
+    // Queued builds start right away, lazy ones on first use or kernel::prefetch
+    kernel deferKernelBuild(const std::string &filename,
+                            const std::string &functionName,
+                            const kernelInfo &info_,
+                            const bool lazy);
+
   public:
     device();
 
@@ -889,6 +1160,7 @@ namespace occa {
     double timeBetween(const tag &startTag, const tag &endTag);
 
     uintptr_t memoryAllocated();
+    uintptr_t hostMemoryAllocated();
 
     void free(stream s);
 
@@ -896,9 +1168,40 @@ namespace occa {
                                  const std::string &functionName,
                                  const kernelInfo &info_ = defaultKernelInfo);
 
+    // Builds every occaKernel in [filename] from one compiled binary
+    std::map<std::string, kernel> buildKernelsFromSource(const std::string &filename,
+                                                         const kernelInfo &info_ = defaultKernelInfo);
+
+    // Returns immediately, the build runs on a pool of OCCA_COMPILE_JOBS threads
+    //   (defaults to the core count)
+    kernel buildKernelFromSourceAsync(const std::string &filename,
+                                      const std::string &functionName,
+                                      const kernelInfo &info_ = defaultKernelInfo);
+
+    // Returns immediately without compiling, the kernel is built (or loaded
+    //   from the cache) on its first launch or in the background after
+    //   kernel::prefetch
+    kernel buildKernelFromSourceLazy(const std::string &filename,
+                                     const std::string &functionName,
+                                     const kernelInfo &info_ = defaultKernelInfo);
+
+    // Benchmarks every candidate in [space] launched with [args] and returns the
+    //   fastest, later builds of [functionName] with [info_] use it
+    //   (the launches overwrite the arguments)
+    kernel autotuneKernel(const std::string &filename,
+                          const std::string &functionName,
+                          const tuningSpace &space,
+                          const std::vector<kernelArg> &args,
+                          const kernelInfo &info_ = defaultKernelInfo);
+
     kernel buildKernelFromBinary(const std::string &filename,
                                  const std::string &functionName);
 
+    // Launches, copies and finish() calls are recorded (not run) until
+    //   endCapture, which returns them as a graph
+    void beginCapture();
+    kernelGraph endCapture();
+
     kernel buildKernelFromLoopy(const std::string &filename,
                                 const std::string &functionName,
                                 int loopyOrFloopy);
@@ -911,6 +1214,17 @@ namespace occa {
     memory malloc(const uintptr_t bytes,
                   void *source = NULL);
 
+    // Maps [bytes] of [filename] from [offset] (bytes = 0 maps to the end of the file)
+    //   CPU modes share pages with the file, other modes copy them to the device
+    memory mapFile(const std::string &filename,
+                   const uintptr_t offset = 0,
+                   const uintptr_t bytes  = 0,
+                   const int flags = occa::mapReadOnly);
+
+    // Page-locked host memory for fast asynchronous copies
+    void* mallocHost(const uintptr_t bytes);
+    void freeHost(void *ptr);
+
     void free();
 
     int simdWidth();
@@ -921,21 +1235,37 @@ namespace occa {
   public:
     std::string occaKeywords, header, flags;
 
+    // Arguments whose launch values are compiled into kernel variants
+    std::vector<std::string> specializedArgs;
+    int maxVariants;
+
+    // "name value" lines, the values replace the arguments in the source
+    std::string specializations;
+
     inline kernelInfo() :
       occaKeywords(""),
       header(""),
-      flags("") {}
+      flags(""),
+      maxVariants(8),
+      specializations("") {}
 
     inline kernelInfo(const kernelInfo &p) :
       occaKeywords(p.occaKeywords),
       header(p.header),
-      flags(p.flags) {}
+      flags(p.flags),
+      specializedArgs(p.specializedArgs),
+      maxVariants(p.maxVariants),
+      specializations(p.specializations) {}
 
     inline kernelInfo& operator = (const kernelInfo &p){
       occaKeywords = p.occaKeywords;
       header = p.header;
       flags  = p.flags;
 
+      specializedArgs = p.specializedArgs;
+      maxVariants     = p.maxVariants;
+      specializations = p.specializations;
+
       return *this;
     }
 
@@ -943,11 +1273,32 @@ namespace occa {
       header += p.header;
       flags  += p.flags;
 
+      specializedArgs.insert(specializedArgs.end(),
+                             p.specializedArgs.begin(), p.specializedArgs.end());
+      specializations += p.specializations;
+
       return *this;
     }
 
+    // Everything prepended to the source or passed to the compiler
     inline std::string salt() const {
-      return (header + flags);
+      return (occaKeywords + header + flags + specializations);
+    }
+
+    // Launches look up (or build in the background) a variant with the value
+    //   of scalar argument [argName] as a constant, the generic kernel runs
+    //   until it is ready and once a kernel has [maxVariants] variants
+    inline void specializeArgument(const std::string &argName){
+      specializedArgs.push_back(argName);
+    }
+
+    inline void setMaxVariants(const int count){
+      maxVariants = count;
+    }
+
+    inline void addSpecialization(const std::string &argName,
+                                  const std::string &value){
+      specializations += argName + ' ' + value + '\n';
     }
 
     inline static bool isAnOccaDefine(const std::string &name){
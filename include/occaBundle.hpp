@@ -0,0 +1,52 @@
+#ifndef OCCA_BUNDLE_HEADER
+#define OCCA_BUNDLE_HEADER
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "occaDefines.hpp"
+
+namespace occa {
+  //---[ Kernel Bundles ]-------------
+  // Cached binaries packed into one file ahead of time, keyed by their cache names
+  //   Builds whose binary is bundled load it instead of compiling
+  //
+  //   Layout (little-endian):
+  //     "OCCABNDL", uint32 bundleVersion, uint32 entries
+  //     entries x [uint32 nameBytes, name, uint64 offset, uint64 bytes]
+  //     binaries
+  static const uint32_t bundleVersion = 1;
+
+  // Records the binaries built while it is alive (not meant for asynchronous builds)
+  class bundleWriter {
+  private:
+    std::vector<std::string> binaries;
+
+  public:
+    bundleWriter();
+    ~bundleWriter();
+
+    void add(const std::string &cachedBinary);
+
+    // Returns the number of bundled binaries
+    int write(const std::string &filename);
+  };
+
+  // Maps [filename] for the rest of the run, returns its binary count
+  //   device::setup loads the ':'-separated bundles in OCCA_BUNDLE
+  int loadBundle(const std::string &filename);
+  void loadEnvironmentBundles();
+
+  // Called by getCachedName
+  void recordCachedBinary(const std::string &cachedBinary);
+
+  // Path of a private, read-only copy of the bundled [cachedBinary] to load,
+  //   "" if it isn't bundled
+  //   Nothing is written to the cache: the copy is a memfd on Linux and a file
+  //   in a per-process temporary directory elsewhere, made once per run
+  std::string getBundledBinary(const std::string &cachedBinary);
+  //==================================
+}
+
+#endif
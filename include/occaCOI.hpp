@@ -52,6 +52,9 @@ namespace occa {
     coiChief chiefID;
 
     coiKernel kernelWrapper[50];
+
+    // Libraries of cached binaries, shared by the kernels built from them
+    std::map<std::string, COILIBRARY> libraries;
   };
   //==================================
 
@@ -143,6 +146,24 @@ namespace occa {
                                   const uintptr_t destOffset,
                                   const uintptr_t srcOffset);
 
+  template <>
+  void memory_t<COI>::fill(const void *pattern,
+                           const uintptr_t patternBytes,
+                           const uintptr_t bytes,
+                           const uintptr_t offset);
+
+  template <>
+  void memory_t<COI>::gather(memory_v *dest,
+                             const memory_v *indices,
+                             const uintptr_t entryBytes,
+                             const uintptr_t entries);
+
+  template <>
+  void memory_t<COI>::scatter(memory_v *dest,
+                              const memory_v *indices,
+                              const uintptr_t entryBytes,
+                              const uintptr_t entries);
+
   template <>
   void memory_t<COI>::free();
   //==================================
@@ -207,11 +228,26 @@ namespace occa {
   memory_v* device_t<COI>::malloc(const uintptr_t bytes,
                                   void *source);
 
+  template <>
+  memory_v* device_t<COI>::mapFile(const std::string &filename,
+                                   const uintptr_t offset,
+                                   const uintptr_t bytes,
+                                   const int flags);
+
+  template <>
+  pinnedBuffer device_t<COI>::mallocHost(const uintptr_t bytes);
+
+  template <>
+  void device_t<COI>::freeHost(pinnedBuffer &buffer);
+
   template <>
   void device_t<COI>::free();
 
   template <>
   int device_t<COI>::simdWidth();
+
+  template <>
+  void device_t<COI>::runGraph(graph_v &graph);
   //==================================
 
 #include "operators/occaCOIFunctionPointerTypeDefs.hpp"
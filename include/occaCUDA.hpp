@@ -22,6 +22,9 @@ namespace occa {
   struct CUDADeviceData_t {
     CUdevice  device;
     CUcontext context;
+
+    // Modules of cached binaries, shared by the kernels built from them
+    std::map<std::string, CUmodule> modules;
   };
   //==================================
 
@@ -113,6 +116,24 @@ namespace occa {
                                    const uintptr_t destOffset,
                                    const uintptr_t srcOffset);
 
+  template <>
+  void memory_t<CUDA>::fill(const void *pattern,
+                            const uintptr_t patternBytes,
+                            const uintptr_t bytes,
+                            const uintptr_t offset);
+
+  template <>
+  void memory_t<CUDA>::gather(memory_v *dest,
+                              const memory_v *indices,
+                              const uintptr_t entryBytes,
+                              const uintptr_t entries);
+
+  template <>
+  void memory_t<CUDA>::scatter(memory_v *dest,
+                               const memory_v *indices,
+                               const uintptr_t entryBytes,
+                               const uintptr_t entries);
+
   template <>
   void memory_t<CUDA>::free();
   //==================================
@@ -177,11 +198,26 @@ namespace occa {
   memory_v* device_t<CUDA>::malloc(const uintptr_t bytes,
                                    void *source);
 
+  template <>
+  memory_v* device_t<CUDA>::mapFile(const std::string &filename,
+                                    const uintptr_t offset,
+                                    const uintptr_t bytes,
+                                    const int flags);
+
+  template <>
+  pinnedBuffer device_t<CUDA>::mallocHost(const uintptr_t bytes);
+
+  template <>
+  void device_t<CUDA>::freeHost(pinnedBuffer &buffer);
+
   template <>
   void device_t<CUDA>::free();
 
   template <>
   int device_t<CUDA>::simdWidth();
+
+  template <>
+  void device_t<CUDA>::runGraph(graph_v &graph);
   //==================================
 
 #include "operators/occaCUDAKernelOperators.hpp"
@@ -0,0 +1,66 @@
+#ifndef OCCA_CACHE_HEADER
+#define OCCA_CACHE_HEADER
+
+#include <string>
+#include <vector>
+#include <map>
+#include <stdint.h>
+
+#include "occaDefines.hpp"
+
+namespace occa {
+  //---[ Cache Index ]----------------
+  // Cached binaries live in [cachePath]/<first two hash digits>/
+  //
+  // [cachePath]/index is an append-only log with a line per build or cache hit:
+  //   lastUse bytes mode entry source
+  //   [entry] is the binary's path relative to the cache path, later lines win
+  //   Pruning compacts it to one line per entry, so does an append once the
+  //   index doubled in size since the last compaction (past 1 MB)
+  //
+  // OCCA_CACHE_SIZE caps the cache size (bytes with an optional K, M or G suffix)
+  //   The least recently used entries are evicted after new builds, under their
+  //   lock and only if unused for a minute
+  class cacheEntry {
+  public:
+    std::string name, mode, source;
+    int64_t lastUse;
+    uint64_t bytes;
+
+    cacheEntry();
+  };
+
+  std::string getCacheIndex();
+
+  // Returns 0 (unbounded) if OCCA_CACHE_SIZE is unset
+  uint64_t getCacheLimit();
+
+  // "512M" -> 512*2^20, returns 0 on unknown suffixes
+  uint64_t parseByteSize(const std::string &str);
+
+  // Called by getCachedName
+  void touchCacheEntry(const std::string &cachedBinary,
+                       const std::string &mode,
+                       const std::string &source);
+
+  // Called by releaseFile, records the size of a newly built binary
+  void addCacheEntry(const std::string &cachedBinary);
+
+  // Latest record of each entry whose binary is still in the cache
+  void readCacheIndex(std::map<std::string, cacheEntry> &entries);
+
+  void writeCacheIndex(const std::map<std::string, cacheEntry> &entries);
+
+  // The binary and the files built next to it (intermediate source, manifest)
+  void getCacheEntryFiles(const std::string &cachedBinary,
+                          std::vector<std::string> &files);
+
+  uint64_t getCacheEntryBytes(const std::string &cachedBinary);
+
+  // Evicts least recently used entries until the cache holds at most [maxBytes]
+  //   Entries being built or used in the last minute are kept, returns the bytes freed
+  uint64_t pruneCache(const uint64_t maxBytes);
+  //==================================
+}
+
+#endif
@@ -0,0 +1,82 @@
+#ifndef OCCA_CAPTURE_HEADER
+#define OCCA_CAPTURE_HEADER
+
+#include "occaBase.hpp"
+
+namespace occa {
+  //---[ Launch Capture ]-------------
+  // Argument of a captured launch
+  class capturedArg {
+  public:
+    enum argType {
+      value,   // Scalar, [bytes] holds its value
+      buffer,  // occa::memory, [bytes] holds its contents
+      alias,   // Same occa::memory as argument [aliasOf]
+      pointer  // Raw pointer, its contents are unknown
+    };
+
+    argType type;
+    std::string bytes;
+    int aliasOf;
+
+    inline capturedArg() :
+      type(value),
+      aliasOf(-1) {}
+  };
+
+  // Everything needed to rebuild a kernel and re-run one of its launches,
+  //   saved as a single file by OCCA_CAPTURE
+  class captureRecord {
+  public:
+    std::string mode, functionName, filename;
+    std::string source;
+
+    std::string header, flags, specializations;
+
+    // -I directories the kernel was built with and the headers it reached
+    //   through them or its own directory, with their contents at launch
+    std::vector<std::string> includeDirs;
+    std::vector<std::string> includes, includeSources;
+
+    int dims;
+    dim inner, outer;
+
+    std::vector<capturedArg> args;
+
+    captureRecord();
+
+    bool load(const std::string &filename_);
+    void save(const std::string &filename_) const;
+
+    // [info] with the captured header, flags and specializations
+    kernelInfo getKernelInfo() const;
+  };
+
+  // Pending capture of a kernel picked by OCCA_CAPTURE
+  //   OCCA_CAPTURE=<kernel>[:<launch>],... saves the <launch>th (default 1st)
+  //   launch of <kernel> in this process to [cachePath]/captures/
+  class kernelCapture {
+  public:
+    std::string filename, functionName;
+    kernelInfo info;
+
+    // The device's compiler flags, their -I directories resolve includes
+    std::string compilerFlags;
+
+    int launch;
+
+    static kernelCapture* start(const std::string &filename,
+                                const std::string &functionName,
+                                const kernelInfo &info,
+                                const std::string &compilerFlags);
+
+    static void launched(kernel_v *kHandle,
+                         const kernelArg *args,
+                         const int argCount);
+  };
+
+  std::string getCapturePath();
+  //==================================
+}
+
+#endif
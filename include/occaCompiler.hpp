@@ -0,0 +1,101 @@
+#ifndef OCCA_COMPILER_HEADER
+#define OCCA_COMPILER_HEADER
+
+#include <string>
+#include <vector>
+
+#include "occaDefines.hpp"
+
+namespace occa {
+  class kernelInfo;
+  class device;
+
+  //---[ Compiler Backends ]----------
+  // Turns CPU-mode kernel sources into the shared libraries that get dlopen'ed
+  //   Backends may use [source] directly or run [command], which compiles the
+  //   intermediate file [source] was written to into [binary]
+  //
+  // The shipped backends all start a compiler process, there is no in-process
+  //   JIT (libgccjit, clang/ORC)
+  //   Processes that must not fork leave builds to occa-compile-server
+  //   (OCCA_COMPILE_SERVER), which does not start anything from them
+  class compilerBackend {
+  public:
+    virtual inline ~compilerBackend(){}
+
+    virtual std::string name() = 0;
+
+    // Returns 0 on success
+    virtual int compile(const std::string &source,
+                        const std::string &binary,
+                        const std::string &command) = 0;
+  };
+
+  // Runs [command] through the shell with system()
+  class systemCompiler : public compilerBackend {
+  public:
+    std::string name();
+
+    int compile(const std::string &source,
+                const std::string &binary,
+                const std::string &command);
+  };
+
+  // Starts the compiler with posix_spawn, without a shell or a copy of the
+  //   caller's address space
+  //   Commands that need a shell (compiler env scripts, pipes, ...) use system()
+  class spawnCompiler : public compilerBackend {
+  public:
+    std::string name();
+
+    int compile(const std::string &source,
+                const std::string &binary,
+                const std::string &command);
+
+    // Splits [command] into arguments, false if it needs a shell
+    static bool splitCommand(const std::string &command,
+                             std::vector<std::string> &args);
+  };
+
+  // OCCA_COMPILER_BACKEND picks the default: spawn (POSIX default) or system
+  compilerBackend& getCompilerBackend();
+
+  // Installs [backend] (owned by the caller), NULL restores the default
+  void setCompilerBackend(compilerBackend *backend);
+  //==================================
+
+
+  //---[ Compile Server ]-------------
+  // Both ends of occa-compile-server, which builds kernels into the cache
+  //   for every process started with OCCA_COMPILE_SERVER set to its socket
+  class compileServer {
+  public:
+    // Socket messages are length-prefixed fields: "<bytes>\n<data>"
+    static const size_t maxFieldBytes = (4 << 20);
+
+    static bool sendField(const int fd, const std::string &field);
+
+    // Fails on fields over maxFieldBytes
+    static bool recvField(const int fd, std::string &field);
+
+    // Asks the server to build [cachedBinary], the name this process gave the
+    //   kernel, true once it is in the cache
+    //   False if no server answered, the build failed there or the server's
+    //   compiler setup names the binary differently
+    static bool build(const std::string &mode,
+                      const std::string &filename,
+                      const std::string &functionName,
+                      const kernelInfo &info,
+                      const std::string &cachedBinary);
+
+    // Server side: builds the kernel into the cache as the requester's
+    //   kernel_t would, without tuning records, profiling or captures
+    static bool buildHere(device &dev,
+                          const std::string &filename,
+                          const std::string &functionName,
+                          const kernelInfo &info);
+  };
+  //==================================
+}
+
+#endif
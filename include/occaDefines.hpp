@@ -76,6 +76,7 @@
       size = sizeof(TYPE);                      \
                                                 \
       pointer = false;                          \
+      mHandle = NULL;                           \
   }
 
 #define OCCA_KERNEL_ARG_CONSTRUCTOR_ALIAS(TYPE, ALIAS)  \
@@ -84,6 +85,7 @@
       size = sizeof(TYPE);                              \
                                                         \
       pointer = false;                                  \
+      mHandle = NULL;                                   \
   }
 
 #define OCCA_EXTRACT_DATA(MODE, CLASS)                          \
@@ -0,0 +1,159 @@
+#ifndef OCCA_GRAPH_HEADER
+#define OCCA_GRAPH_HEADER
+
+#include "occaBase.hpp"
+
+namespace occa {
+  //---[ Kernel Graphs ]--------------
+  // Launch, copy, fill, gather, scatter or device::finish() recorded between
+  //   device::beginCapture and device::endCapture
+  class graphNode {
+  public:
+    enum nodeType {
+      launch,
+      copy,
+      fill,
+      gather,
+      scatter,
+      barrier
+    };
+
+    nodeType type;
+    stream s;
+
+    // Launches
+    kernel_v *kHandle;
+
+    int dims;
+    dim inner, outer;
+
+    int argCount;
+    kernelArg args[OCCA_MAX_ARGS];
+
+    // Copies, memory sides use the offsets and host sides the pointers
+    memory_v *destMem, *srcMem;
+    void *destPtr;
+    const void *srcPtr;
+
+    uintptr_t bytes, destOffset, srcOffset;
+
+    // Fills write [pattern] over [bytes] of destMem from destOffset
+    std::string pattern;
+
+    // Gathers and scatters go from srcMem to destMem through indicesMem
+    memory_v *indicesMem;
+    uintptr_t entryBytes, entries;
+
+    inline graphNode() :
+      type(barrier),
+      s(NULL),
+      kHandle(NULL),
+      dims(0),
+      argCount(0),
+      destMem(NULL),
+      srcMem(NULL),
+      destPtr(NULL),
+      srcPtr(NULL),
+      bytes(0),
+      destOffset(0),
+      srcOffset(0),
+      indicesMem(NULL),
+      entryBytes(0),
+      entries(0) {}
+  };
+
+  // Launch descriptors a mode precomputes for its replays
+  class graphPlan {
+  public:
+    virtual inline ~graphPlan(){}
+  };
+
+  class graph_v {
+  public:
+    occa::device *dev;
+
+    std::vector<graphNode> nodes;
+
+    // Set by the mode on the first replay, dropped when arguments change
+    graphPlan *plan;
+
+    inline graph_v() :
+      dev(NULL),
+      plan(NULL) {}
+
+    inline ~graph_v(){
+      dropPlan();
+    }
+
+    // Records the launch or copy if [dev] is capturing, returns false otherwise
+    static bool captureLaunch(kernel_v *kHandle,
+                              const kernelArg *args,
+                              const int argCount);
+
+    static bool captureCopy(occa::device *dev,
+                            memory_v *destMem, void *destPtr,
+                            memory_v *srcMem, const void *srcPtr,
+                            const uintptr_t bytes,
+                            const uintptr_t destOffset,
+                            const uintptr_t srcOffset);
+
+    static bool captureFill(occa::device *dev,
+                            memory_v *destMem,
+                            const void *pattern,
+                            const uintptr_t patternBytes,
+                            const uintptr_t bytes,
+                            const uintptr_t destOffset);
+
+    // [type] is gather or scatter
+    static bool captureIndexedCopy(occa::device *dev,
+                                   const graphNode::nodeType type,
+                                   memory_v *destMem,
+                                   memory_v *srcMem,
+                                   memory_v *indicesMem,
+                                   const uintptr_t entryBytes,
+                                   const uintptr_t entries);
+
+    static bool captureFinish(occa::device *dev);
+
+    // Hands the graph to its device's mode
+    void run();
+
+    // Waits for replays still using the plan before freeing it
+    void dropPlan();
+
+    // Replays the nodes one by one, in capture order on their streams
+    void runNodes();
+  };
+
+  // Launches and copies replayed without re-resolving kernels or arguments
+  //   Kernels and memory used by the graph have to outlive it
+  class kernelGraph {
+    friend class occa::device;
+
+  private:
+    graph_v *gHandle;
+
+  public:
+    kernelGraph();
+
+    kernelGraph(const kernelGraph &g);
+    kernelGraph& operator = (const kernelGraph &g);
+
+    // Nodes are numbered in capture order: launches, copies and finish() calls
+    int nodeCount();
+
+    // Changes argument [argPos] of launch [node] for later replays
+    //   The launch keeps the kernel variant picked when it was captured
+    void setArgument(const int node,
+                     const int argPos,
+                     const kernelArg &arg);
+
+    // Queues the whole graph, device::finish() waits for it
+    void run();
+
+    void free();
+  };
+  //==================================
+}
+
+#endif
@@ -0,0 +1,107 @@
+#ifndef OCCA_MIRROR_HEADER
+#define OCCA_MIRROR_HEADER
+
+#include "occaBase.hpp"
+
+namespace occa {
+  //---[ Mirror ]---------------------
+  // State shared by every copy of a mirror
+  class mirror_v {
+  public:
+    occa::memory mem;
+    char *hostPtr;
+
+    uintptr_t size;
+    bool zeroCopy;
+
+    int state;
+
+    uintptr_t transfers, avoidedTransfers;
+
+    int refs;
+
+    inline mirror_v() :
+      hostPtr(NULL),
+      size(0),
+      zeroCopy(false),
+      state(0), // mirror::inSync
+      transfers(0),
+      avoidedTransfers(0),
+      refs(1) {}
+  };
+
+  // Host/device buffer pair that only transfers when the other side is stale
+  //   CPU modes share one allocation, syncs never copy
+  //   Copies share the buffers and their state, free() releases them for all
+  class mirror {
+  private:
+    mirror_v *mHandle;
+
+    void syncToHost();
+    void syncToDevice();
+
+  public:
+    static const int inSync      = 0;
+    static const int hostDirty   = 1;
+    static const int deviceDirty = 2;
+
+    mirror();
+
+    mirror(occa::device &dev,
+           const uintptr_t bytes,
+           const void *source = NULL);
+
+    mirror(const mirror &m);
+    mirror& operator = (const mirror &m);
+
+    ~mirror();
+
+    void allocate(occa::device &dev,
+                  const uintptr_t bytes,
+                  const void *source = NULL);
+
+    inline uintptr_t bytes() const {
+      return mHandle->size;
+    }
+
+    inline int status() const {
+      return mHandle->state;
+    }
+
+    //---[ Host Access ]--------------
+    void* host();
+    const void* hostRead();
+
+    // Contents will be overwritten, skips the sync
+    void* hostWrite();
+
+    void hostModified();
+    //================================
+
+    //---[ Device Access ]------------
+    // Kernel arguments, passing the mirror itself means read-write
+    kernelArg read();
+    kernelArg write();
+
+    operator kernelArg ();
+
+    occa::memory& deviceMemory();
+
+    void deviceModified();
+    //================================
+
+    inline uintptr_t transfers() const {
+      return mHandle->transfers;
+    }
+
+    // Stale copies that didn't need a transfer (CPU modes)
+    inline uintptr_t avoidedTransfers() const {
+      return mHandle->avoidedTransfers;
+    }
+
+    void free();
+  };
+  //==================================
+};
+
+#endif
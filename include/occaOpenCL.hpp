@@ -33,6 +33,13 @@ namespace occa {
     cl_platform_id platformID;
     cl_device_id   deviceID;
     cl_context     context;
+
+    // Built on first use by gather/scatter
+    cl_program memoryProgram;
+    cl_kernel  gatherKernel, scatterKernel;
+
+    // Programs of cached binaries, shared by the kernels built from them
+    std::map<std::string, cl_program> programs;
   };
   //==================================
 
@@ -62,6 +69,14 @@ namespace occa {
     int deviceCoreCount(int pID, int dID);
 
     occa::deviceInfo deviceInfo(int pID, int dID);
+
+    void buildMemoryKernels(OpenCLDeviceData_t &data_);
+
+    void runIndexKernel(cl_command_queue &stream,
+                        cl_kernel kernel,
+                        cl_mem dest, cl_mem src, cl_mem indices,
+                        const uintptr_t entryBytes,
+                        const uintptr_t entries);
   };
   //==================================
 
@@ -153,6 +168,24 @@ namespace occa {
                                      const uintptr_t destOffset,
                                      const uintptr_t srcOffset);
 
+  template <>
+  void memory_t<OpenCL>::fill(const void *pattern,
+                              const uintptr_t patternBytes,
+                              const uintptr_t bytes,
+                              const uintptr_t offset);
+
+  template <>
+  void memory_t<OpenCL>::gather(memory_v *dest,
+                                const memory_v *indices,
+                                const uintptr_t entryBytes,
+                                const uintptr_t entries);
+
+  template <>
+  void memory_t<OpenCL>::scatter(memory_v *dest,
+                                 const memory_v *indices,
+                                 const uintptr_t entryBytes,
+                                 const uintptr_t entries);
+
   template <>
   void memory_t<OpenCL>::free();
   //==================================
@@ -220,11 +253,26 @@ namespace occa {
   memory_v* device_t<OpenCL>::malloc(const uintptr_t bytes,
                                      void *source);
 
+  template <>
+  memory_v* device_t<OpenCL>::mapFile(const std::string &filename,
+                                      const uintptr_t offset,
+                                      const uintptr_t bytes,
+                                      const int flags);
+
+  template <>
+  pinnedBuffer device_t<OpenCL>::mallocHost(const uintptr_t bytes);
+
+  template <>
+  void device_t<OpenCL>::freeHost(pinnedBuffer &buffer);
+
   template <>
   void device_t<OpenCL>::free();
 
   template <>
   int device_t<OpenCL>::simdWidth();
+
+  template <>
+  void device_t<OpenCL>::runGraph(graph_v &graph);
   //==================================
 
 #include "operators/occaOpenCLKernelOperators.hpp"
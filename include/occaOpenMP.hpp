@@ -10,6 +10,7 @@
 #include "occaBase.hpp"
 
 #include "occaKernelDefines.hpp"
+#include "occaCompiler.hpp"
 
 #if   OCCA_OS == LINUX_OS
 #  include <dlfcn.h>
@@ -114,12 +115,33 @@ namespace occa {
                                      const uintptr_t destOffset,
                                      const uintptr_t srcOffset);
 
+  template <>
+  void memory_t<OpenMP>::fill(const void *pattern,
+                              const uintptr_t patternBytes,
+                              const uintptr_t bytes,
+                              const uintptr_t offset);
+
+  template <>
+  void memory_t<OpenMP>::gather(memory_v *dest,
+                                const memory_v *indices,
+                                const uintptr_t entryBytes,
+                                const uintptr_t entries);
+
+  template <>
+  void memory_t<OpenMP>::scatter(memory_v *dest,
+                                 const memory_v *indices,
+                                 const uintptr_t entryBytes,
+                                 const uintptr_t entries);
+
   template <>
   void memory_t<OpenMP>::free();
   //==================================
 
 
   //---[ Device ]---------------------
+  template <>
+  std::vector<occa::deviceInfo> availableDevices<OpenMP>();
+
   template <>
   device_t<OpenMP>::device_t();
 
@@ -178,11 +200,26 @@ namespace occa {
   memory_v* device_t<OpenMP>::malloc(const uintptr_t bytes,
                                      void *source);
 
+  template <>
+  memory_v* device_t<OpenMP>::mapFile(const std::string &filename,
+                                      const uintptr_t offset,
+                                      const uintptr_t bytes,
+                                      const int flags);
+
+  template <>
+  pinnedBuffer device_t<OpenMP>::mallocHost(const uintptr_t bytes);
+
+  template <>
+  void device_t<OpenMP>::freeHost(pinnedBuffer &buffer);
+
   template <>
   void device_t<OpenMP>::free();
 
   template <>
   int device_t<OpenMP>::simdWidth();
+
+  template <>
+  void device_t<OpenMP>::runGraph(graph_v &graph);
   //==================================
 
 #include "operators/occaFunctionPointerTypeDefs.hpp"
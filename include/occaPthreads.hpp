@@ -16,6 +16,7 @@
 #include "occaBase.hpp"
 
 #include "occaKernelDefines.hpp"
+#include "occaCompiler.hpp"
 
 namespace occa {
   //---[ Data Structs ]---------------
@@ -31,7 +32,8 @@ namespace occa {
 
     pthread_t tid[50];
 
-    int pendingJobs;
+    volatile int pendingJobs;
+    volatile uintptr_t finishedJobs; // Summed over workers, never decreases
 
     std::queue<PthreadLaunchHandle_t> kernelLaunch[50];
     std::queue<PthreadKernelArg_t*> kernelArgs[50];
@@ -43,7 +45,7 @@ namespace occa {
     void *dlHandle, *handle;
     int pThreadCount;
 
-    int *pendingJobs;
+    volatile int *pendingJobs;
 
     std::queue<PthreadLaunchHandle_t> *kernelLaunch[50];
     std::queue<PthreadKernelArg_t*> *kernelArgs[50];
@@ -55,7 +57,8 @@ namespace occa {
     int rank, count;
     int pinnedCore;
 
-    int *pendingJobs;
+    volatile int *pendingJobs;
+    volatile uintptr_t *finishedJobs;
 
     std::queue<PthreadLaunchHandle_t> *kernelLaunch;
     std::queue<PthreadKernelArg_t*> *kernelArgs;
@@ -167,12 +170,33 @@ namespace occa {
                                        const uintptr_t destOffset,
                                        const uintptr_t srcOffset);
 
+  template <>
+  void memory_t<Pthreads>::fill(const void *pattern,
+                                const uintptr_t patternBytes,
+                                const uintptr_t bytes,
+                                const uintptr_t offset);
+
+  template <>
+  void memory_t<Pthreads>::gather(memory_v *dest,
+                                  const memory_v *indices,
+                                  const uintptr_t entryBytes,
+                                  const uintptr_t entries);
+
+  template <>
+  void memory_t<Pthreads>::scatter(memory_v *dest,
+                                   const memory_v *indices,
+                                   const uintptr_t entryBytes,
+                                   const uintptr_t entries);
+
   template <>
   void memory_t<Pthreads>::free();
   //==================================
 
 
   //---[ Device ]---------------------
+  template <>
+  std::vector<occa::deviceInfo> availableDevices<Pthreads>();
+
   template <>
   device_t<Pthreads>::device_t();
 
@@ -234,8 +258,23 @@ namespace occa {
   memory_v* device_t<Pthreads>::malloc(const uintptr_t bytes,
                                        void *source);
 
+  template <>
+  memory_v* device_t<Pthreads>::mapFile(const std::string &filename,
+                                        const uintptr_t offset,
+                                        const uintptr_t bytes,
+                                        const int flags);
+
+  template <>
+  pinnedBuffer device_t<Pthreads>::mallocHost(const uintptr_t bytes);
+
+  template <>
+  void device_t<Pthreads>::freeHost(pinnedBuffer &buffer);
+
   template <>
   int device_t<Pthreads>::simdWidth();
+
+  template <>
+  void device_t<Pthreads>::runGraph(graph_v &graph);
   //==================================
 
 #include "operators/occaFunctionPointerTypeDefs.hpp"
@@ -254,6 +293,8 @@ namespace occa {
 #  warning "Affinity not guaranteed in this OS"
 #endif
 
+    uintptr_t jobs = 0;
+
     while(true){
       // Fence local data (incase of out-of-socket updates)
       __asm__ __volatile__ ("lfence");
@@ -273,12 +314,19 @@ namespace occa {
 
         launchKernel(launchArgs);
 
+        delete &launchArgs;
+
         //---[ Barrier ]----------------
         pthread_mutex_lock(data.pendingJobsMutex);
         --( *(data.pendingJobs) );
+        ++( *(data.finishedJobs) );
         pthread_mutex_unlock(data.pendingJobsMutex);
 
-        while((*data.pendingJobs) % data.count)
+        // Waiting on a count that only grows, pendingJobs can be
+        //   back to a multiple of [count] before a slow worker sees it
+        ++jobs;
+
+        while(*(data.finishedJobs) < (jobs * data.count))
           __asm__ __volatile__ ("lfence");
         //==============================
       }
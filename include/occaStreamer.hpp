@@ -0,0 +1,109 @@
+#ifndef OCCA_STREAMER_HEADER
+#define OCCA_STREAMER_HEADER
+
+#include "occaBase.hpp"
+
+namespace occa {
+  //---[ Streamer ]-------------------
+  // Runs a 1D kernel over host arrays larger than the device memory
+  //   The index space is split into chunks that fit in [budgetBytes] and
+  //   each chunk is uploaded, computed and downloaded on its own stream
+  //   while the neighboring chunks are in flight
+  class streamer {
+  private:
+    static const int fixedArg   = 0;
+    static const int entriesArg = 1;
+    static const int offsetArg  = 2;
+    static const int inputArg   = 3;
+    static const int outputArg  = 4;
+    static const int inOutArg   = 5;
+
+    class streamerArg {
+    public:
+      int type;
+
+      char *ptr;
+      uintptr_t entryBytes;
+
+      kernelArg arg;
+    };
+
+    occa::device *dev;
+    occa::kernel ker;
+
+    uintptr_t budgetBytes;
+    int buffers;
+    int innerDim;
+    bool zeroCopy;
+
+    std::vector<streamerArg> args;
+    std::vector<stream> streams;
+
+    // [slot][streamed array], kept between runs while chunks still fit
+    std::vector< std::vector<occa::memory> > slotMemory;
+    uintptr_t slotEntries;
+
+    // [slot] chunk whose outputs are still in the slot (CPU modes)
+    std::vector<uintptr_t> pendingChunk;
+
+    uintptr_t chunkEntries_;
+
+    void addStreamedArg(const int type,
+                        void *ptr,
+                        const uintptr_t entryBytes);
+
+    void launchChunk(const int slot,
+                     const uintptr_t offset,
+                     const uintptr_t entries);
+
+    void allocateSlots(const int slots,
+                       const uintptr_t chunk);
+
+    void downloadChunk(const int slot,
+                       const uintptr_t offset,
+                       const uintptr_t entries);
+
+  public:
+    streamer(occa::device &dev_,
+             occa::kernel &ker_,
+             const uintptr_t budgetBytes_,
+             const int buffers_ = 3);
+
+    // Work-group size, defaults to the kernel's preferred size
+    void setInnerDim(const int innerDim_);
+
+    // Stages Pthreads and OpenMP chunks like the other modes
+    //   instead of passing host pointers straight to the kernel
+    void disableZeroCopy();
+
+    //---[ Arguments ]----------------
+    // Kernel arguments, in the order they are added
+    void addChunkEntriesArg();
+    void addChunkOffsetArg();
+
+    void addInput(const void *src,
+                  const uintptr_t entryBytes);
+
+    void addOutput(void *dest,
+                   const uintptr_t entryBytes);
+
+    void addInOut(void *ptr,
+                  const uintptr_t entryBytes);
+
+    // Passed unchanged to every chunk
+    void addArgument(const kernelArg &arg);
+    //================================
+
+    inline uintptr_t chunkEntries() const {
+      return chunkEntries_;
+    }
+
+    void run(const uintptr_t entries);
+
+    // Releases the chunk buffers kept between runs
+    void free();
+  };
+  //==================================
+};
+
+#endif
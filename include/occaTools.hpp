@@ -3,6 +3,8 @@
 
 #include <iostream>
 #include <string>  // required by windows
+#include <vector>
+#include <stdint.h>
 #include <stdlib.h>
 #include <assert.h>
 
@@ -40,22 +42,187 @@ namespace occa {
                                    std::string &prefix,
                                    std::string &filename);
 
+  // Absolute path with symlinks resolved, [filename] if it can't be resolved
+  std::string getCanonicalPath(const std::string &filename);
+
   bool haveFile(const std::string &filename);
 
-  void waitForFile(const std::string &filename);
+  // Returns false if the lock was taken over from a failed or dead owner
+  //   (the caller then makes [filename] and releases it)
+  bool waitForFile(const std::string &filename);
 
   void releaseFile(const std::string &filename);
 
-  std::string fnv(const std::string &filename);
+  //---[ Hashing ]--------------------
+  // Streaming 128-bit MurmurHash3 (x64 variant)
+  class hasher {
+  private:
+    uint64_t h1, h2;
+    uint64_t totalBytes;
+
+    unsigned char tail[16];
+    int tailBytes;
+
+    void mixBlock(const unsigned char *block);
+
+  public:
+    hasher(const uint64_t seed = 0);
+
+    void update(const void *data,
+                const uintptr_t bytes);
+
+    void update(const std::string &str);
+
+    // 32 hex characters, the hasher can keep being updated
+    std::string digest() const;
+  };
+
+  std::string hashString(const std::string &str);
+
+  std::string hashFile(const std::string &filename);
+
+  // [source] with comments removed and whitespace collapsed to what keeps
+  //   tokens (and preprocessor lines) apart, string literals are kept as is
+  std::string normalizeSource(const std::string &source);
+
+  // Hash of the normalized source for C-family files (.occa, .okl, .cl, .cu,
+  //   C/C++ sources and headers), of the raw bytes otherwise
+  //   Hashes are reused until the file's size or modification time changes
+  std::string hashNormalizedFile(const std::string &filename);
+  //==================================
 
   std::string readFile(const std::string &filename);
 
+  // Bumped when cached binary names are no longer comparable
+  static const char cacheVersion[] = "v2";
+
+  // Files reached through #include from [source], resolved against
+  //   [sourceDir] for quoted includes and the -I directories in [flags]
+  //   Unresolved includes (system headers) are skipped
+  void getIncludeClosure(const std::string &source,
+                         const std::string &sourceDir,
+                         const std::string &flags,
+                         std::vector<std::string> &deps);
+
+  // Include closure of [filename] and of the kernelInfo header in [salt], with
+  //   the normalized digest of each header, as cached binary names use it
+  void hashIncludeClosure(const std::string &filename,
+                          const std::string &salt,
+                          const std::string &compilerFlags,
+                          std::vector<std::string> &deps,
+                          std::vector<std::string> &hashes);
+
+  // [cachedBinary].deps, written when the binary is built:
+  //   a "<hash> <path>" line per header in its include closure
+  void readDependencyManifest(const std::string &cachedBinary,
+                              std::vector<std::string> &deps,
+                              std::vector<std::string> &hashes);
+
+  // Functions declared with occaKernel in [source]
+  void getKernelNames(const std::string &source,
+                      std::vector<std::string> &names);
+
+  // Arguments of occaKernel [functionName] after occaKernelInfoArg
+  //   [types] hold each declaration without its name
+  bool getKernelArguments(const std::string &source,
+                          const std::string &functionName,
+                          std::vector<std::string> &names,
+                          std::vector<std::string> &types);
+
+  // Kernels in [source] taking an argument named in [specializations]
+  //   ("name value" lines) get it as a constant, the argument is renamed
+  std::string specializeSource(const std::string &source,
+                               const std::string &specializations);
+
+  // OCCA_CACHE_DIR (or the default cache directory) with a trailing slash
+  std::string getCachePath();
+
+  // Read-only caches in OCCA_SYSTEM_CACHE (':'-separated), consulted in
+  //   order before OCCA_CACHE_DIR, each with a trailing slash
+  const std::vector<std::string>& getCacheLayers();
+
+  // [entry] (relative to a cache directory) in the first read-only layer
+  //   holding it, "" if none does
+  std::string findInCacheLayers(const std::string &entry);
+
+  // The read-only layer copy of [cachedFile] (a path in getCachePath()),
+  //   [cachedFile] itself if no layer has it
+  std::string getLayeredCachePath(const std::string &cachedFile);
+
+  // CPU model and core count, machines sharing it share tuning records
+  std::string getMachineFingerprint();
+
+  // ISA extensions of the host CPU found with cpuid ("x86_64 sse3 ... avx2"),
+  //   salted into CPU-mode binaries so hosts with other ISAs don't share them
+  std::string getCpuIsa();
+
+  // Flags targeting getCpuIsa(), added to the default Pthreads and OpenMP flags
+  std::string getCpuTargetFlags();
+
+  // [cachePath]/<shard>/v2_<hash>, [mode] is recorded in the cache index
+  //   -I directories in [compilerFlags] and [salt] are searched for headers
   std::string getCachedName(const std::string &filename,
-                            const std::string &salt);
+                            const std::string &salt,
+                            const std::string &mode = "",
+                            const std::string &compilerFlags = "");
 
+  // [preludeHeader] is included in place of the inlined occaKeywords
   std::string createIntermediateSource(const std::string &filename,
                                        const std::string &cachedBinary,
-                                       const kernelInfo &info);
+                                       const kernelInfo &info,
+                                       const std::string &preludeHeader = "");
+
+  // Caches [prelude] as a header precompiled with [compilerCommand] (compiler and flags)
+  //   Returns the header to include, "" if disabled (OCCA_PCH=0) or unsupported
+  std::string getPrecompiledPrelude(const std::string &compilerEnvScript,
+                                    const std::string &compilerCommand,
+                                    const std::string &prelude);
+
+  //---[ File Mapping ]--------------
+  // Returns [filename] + [offset] mapped with device::mapFile [flags]
+  //   [bytes] = 0 is set to the rest of the file
+  //   [mappedPtr] and [mappedBytes] cover the page-aligned mapping for unmapFile
+  void* mapFile(const std::string &filename,
+                const uintptr_t offset,
+                uintptr_t &bytes,
+                const int flags,
+                void *&mappedPtr,
+                uintptr_t &mappedBytes);
+
+  void unmapFile(void *mappedPtr,
+                 const uintptr_t mappedBytes);
+  //==================================
+
+  //---[ Pinned Host Memory ]--------
+  // Page-aligned host memory locked into RAM, stays pageable if locking fails
+  void* pinnedAlloc(const uintptr_t bytes);
+
+  void pinnedFree(void *ptr,
+                  const uintptr_t bytes);
+  //==================================
+
+  //---[ Host Memory Helpers ]--------
+  // [rank] and [count] split the work across CPU workers
+  void memFill(void *ptr,
+               const void *pattern,
+               const uintptr_t patternBytes,
+               const uintptr_t bytes,
+               const int rank = 0, const int count = 1);
+
+  void memGather(void *dest,
+                 const void *src,
+                 const int *indices,
+                 const uintptr_t entryBytes,
+                 const uintptr_t entries,
+                 const int rank = 0, const int count = 1);
+
+  void memScatter(void *dest,
+                  const void *src,
+                  const int *indices,
+                  const uintptr_t entryBytes,
+                  const uintptr_t entries,
+                  const int rank = 0, const int count = 1);
+  //==================================
 };
 
 #endif
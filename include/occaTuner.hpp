@@ -0,0 +1,79 @@
+#ifndef OCCA_TUNER_HEADER
+#define OCCA_TUNER_HEADER
+
+#include "occaBase.hpp"
+
+namespace occa {
+  //---[ Autotuning ]-----------------
+  // Candidates for device::autotuneKernel, every combination of inner
+  //   dimensions, define values and compiler flag sets is benchmarked
+  class tuningSpace {
+  public:
+    int dims;
+    dim global;
+
+    std::vector<dim> innerDims;
+    std::string innerDefines[3];
+
+    std::vector<std::string> defineNames;
+    std::vector< std::vector<std::string> > defineValues;
+
+    std::vector<std::string> flagSets;
+
+    int warmup, repetitions;
+
+    // Outer dimensions cover [global_] work-items for each inner size
+    tuningSpace(const int dims_, const dim &global_);
+
+    void addInnerDims(const dim &inner);
+
+    // Defines [x] (and [y], [z]) to the candidate's inner dimensions
+    void setInnerDefines(const std::string &x,
+                         const std::string &y = "",
+                         const std::string &z = "");
+
+    // Adds [value] to the candidates of [name]
+    template <class TM>
+    inline void addDefine(const std::string &name, const TM &value){
+      std::stringstream ss;
+      ss << value;
+
+      const int defineCount = defineNames.size();
+
+      for(int i = 0; i < defineCount; ++i){
+        if(defineNames[i] == name){
+          defineValues[i].push_back(ss.str());
+          return;
+        }
+      }
+
+      defineNames.push_back(name);
+      defineValues.push_back(std::vector<std::string>(1, ss.str()));
+    }
+
+    void addCompilerFlags(const std::string &flags);
+  };
+
+  // Winning candidate, kept in [cachePath]/tuning/
+  class tuningRecord {
+  public:
+    int dims;
+    dim inner;
+
+    std::vector<std::string> defineNames, defineValues;
+    std::string flags;
+
+    double seconds;
+
+    tuningRecord();
+
+    bool load(const std::string &filename);
+    void save(const std::string &filename) const;
+
+    // Adds the defines and flags
+    void apply(kernelInfo &info) const;
+  };
+  //==================================
+}
+
+#endif
@@ -0,0 +1,125 @@
+// Builds every kernel listed in a manifest and packs the binaries into one bundle
+//
+//   occaBundle <manifest> <bundle>
+//
+// Manifest lines (# starts a comment):
+//   <mode>[:arg1:arg2]  <file>  <function | *>  [-DNAME=VALUE ...]  [compiler flags ...]
+//
+//   OpenMP        addVectors.occa  addVectors  -DTILE=16
+//   OpenCL:0:1    stencil.occa     *
+//
+// Load the bundle with OCCA_BUNDLE=<bundle> or occa::loadBundle(<bundle>),
+//   the compiler, compiler flags and sources must match the ones used here
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <map>
+
+#include "occa.hpp"
+
+static occa::device& getDevice(std::map<std::string, occa::device> &devices,
+                               const std::string &modeArgs){
+  std::map<std::string, occa::device>::iterator it = devices.find(modeArgs);
+
+  if(it != devices.end())
+    return it->second;
+
+  std::string mode = modeArgs;
+  int arg1 = 0, arg2 = 0;
+
+  const size_t colon = modeArgs.find(':');
+
+  if(colon != std::string::npos){
+    mode = modeArgs.substr(0, colon);
+
+    std::string args = modeArgs.substr(colon + 1);
+
+    for(size_t i = 0; i < args.size(); ++i){
+      if(args[i] == ':')
+        args[i] = ' ';
+    }
+
+    std::stringstream ss(args);
+    ss >> arg1 >> arg2;
+  }
+
+  occa::device &dev = devices[modeArgs];
+  dev.setup(mode, arg1, arg2);
+
+  return dev;
+}
+
+int main(int argc, char **argv){
+  if(argc != 3){
+    std::cout << "Usage: " << argv[0] << " <manifest> <bundle>\n";
+    return 1;
+  }
+
+  std::ifstream manifest(argv[1]);
+
+  if(!manifest){
+    std::cout << "Could not open manifest [" << argv[1] << "]\n";
+    return 1;
+  }
+
+  std::map<std::string, occa::device> devices;
+  occa::bundleWriter bundle;
+
+  std::string line;
+  int lineNumber = 0, kernels = 0;
+
+  while(std::getline(manifest, line)){
+    ++lineNumber;
+
+    const size_t comment = line.find('#');
+
+    if(comment != std::string::npos)
+      line = line.substr(0, comment);
+
+    std::stringstream ss(line);
+    std::string modeArgs, filename, functionName, option;
+
+    if(!(ss >> modeArgs))
+      continue;
+
+    if(!(ss >> filename >> functionName)){
+      std::cout << argv[1] << ":" << lineNumber << ": expected <mode> <file> <function>\n";
+      return 1;
+    }
+
+    occa::kernelInfo info;
+
+    while(ss >> option){
+      if(option.compare(0, 2, "-D") == 0){
+        const size_t equals = option.find('=');
+
+        if(equals == std::string::npos)
+          info.addDefine(option.substr(2), 1);
+        else
+          info.addDefine(option.substr(2, equals - 2), option.substr(equals + 1));
+      }
+      else
+        info.addCompilerFlag(option);
+    }
+
+    occa::device &dev = getDevice(devices, modeArgs);
+
+    if(functionName == "*"){
+      std::map<std::string, occa::kernel> fileKernels = dev.buildKernelsFromSource(filename, info);
+
+      kernels += fileKernels.size();
+    }
+    else{
+      dev.buildKernelFromSource(filename, functionName, info);
+      ++kernels;
+    }
+  }
+
+  const int binaries = bundle.write(argv[2]);
+
+  std::cout << "Bundled " << binaries << " binaries for "
+            << kernels << " kernels into [" << argv[2] << "]\n";
+
+  return 0;
+}
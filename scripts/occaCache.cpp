@@ -0,0 +1,349 @@
+// Maintenance for the kernel cache in OCCA_CACHE_DIR (or the default cache directory)
+//
+//   occa-cache stats           Entries, sizes and last uses per mode
+//   occa-cache prune [size]    Evicts least recently used entries down to [size]
+//                                (defaults to OCCA_CACHE_SIZE), removes files left
+//                                by the unsharded layout and compacts the index
+//   occa-cache verify [--fix]  Checks the index against the cache, --fix re-indexes
+//                                unindexed binaries and evicts entries whose
+//                                headers changed since they were built
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <map>
+
+#include <time.h>
+#include <dirent.h>
+
+#include "occa.hpp"
+
+static const char hexDigits[] = "0123456789abcdef";
+
+static bool isHexName(const std::string &name, const size_t offset, const size_t chars){
+  if(name.size() < (offset + chars))
+    return false;
+
+  for(size_t i = offset; i < (offset + chars); ++i){
+    if(strchr(hexDigits, name[i]) == NULL)
+      return false;
+  }
+
+  return true;
+}
+
+static void listDirectory(const std::string &dir,
+                          std::vector<std::string> &names){
+  DIR *d = opendir(dir.c_str());
+
+  if(d == NULL)
+    return;
+
+  struct dirent *e;
+
+  while((e = readdir(d)) != NULL){
+    const std::string name(e->d_name);
+
+    if((name != ".") && (name != ".."))
+      names.push_back(name);
+  }
+
+  closedir(d);
+}
+
+static std::string prettyBytes(const uint64_t bytes){
+  std::stringstream ss;
+
+  if(bytes < (1 << 10))
+    ss << bytes << " B";
+  else if(bytes < (1 << 20))
+    ss << (bytes >> 10) << " KB";
+  else
+    ss << std::fixed << std::setprecision(1) << (bytes / ((double) (1 << 20))) << " MB";
+
+  return ss.str();
+}
+
+static std::string prettyTime(const int64_t t){
+  char buffer[64];
+  const time_t tt = (time_t) t;
+
+  strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M", localtime(&tt));
+
+  return std::string(buffer);
+}
+
+static int stats(){
+  std::map<std::string, occa::cacheEntry> entries;
+  occa::readCacheIndex(entries);
+
+  std::map<std::string, int> modeEntries;
+  std::map<std::string, uint64_t> modeBytes;
+
+  uint64_t totalBytes = 0;
+  int64_t oldest = 0, newest = 0;
+
+  std::map<std::string, occa::cacheEntry>::iterator it = entries.begin();
+
+  while(it != entries.end()){
+    const occa::cacheEntry &entry = it->second;
+    const std::string mode = (entry.mode.size() ? entry.mode : "?");
+
+    ++modeEntries[mode];
+    modeBytes[mode] += entry.bytes;
+    totalBytes      += entry.bytes;
+
+    if((oldest == 0) || (entry.lastUse < oldest))
+      oldest = entry.lastUse;
+    if(newest < entry.lastUse)
+      newest = entry.lastUse;
+
+    ++it;
+  }
+
+  const uint64_t limit = occa::getCacheLimit();
+
+  std::cout << "Cache   : " << occa::getCachePath() << '\n';
+
+  // Read-only layers are not indexed, they are only listed
+  const std::vector<std::string> &layers = occa::getCacheLayers();
+
+  for(size_t i = 0; i < layers.size(); ++i)
+    std::cout << "Layer   : " << layers[i] << " (read-only)\n";
+
+  std::cout << "Entries : " << entries.size() << '\n'
+            << "Size    : " << prettyBytes(totalBytes);
+
+  if(limit)
+    std::cout << " of " << prettyBytes(limit) << " (OCCA_CACHE_SIZE)";
+
+  std::cout << '\n';
+
+  if(entries.size()){
+    std::cout << "Used    : " << prettyTime(oldest) << " to " << prettyTime(newest) << '\n';
+
+    std::map<std::string, int>::iterator mit = modeEntries.begin();
+
+    while(mit != modeEntries.end()){
+      std::cout << "  " << std::setw(10) << std::left << mit->first
+                << std::setw(6) << std::right << mit->second << " entries  "
+                << prettyBytes(modeBytes[mit->first]) << '\n';
+      ++mit;
+    }
+  }
+
+  return 0;
+}
+
+// Binaries and intermediates written before the cache was sharded
+static int removeUnshardedFiles(const std::string &cachePath){
+  const std::string version = std::string(occa::cacheVersion) + "_";
+  const size_t vChars = version.size();
+
+  std::vector<std::string> names;
+  listDirectory(cachePath, names);
+
+  int removed = 0;
+
+  for(size_t i = 0; i < names.size(); ++i){
+    const std::string &name = names[i];
+
+    size_t offset = 0;
+
+    if(name.compare(0, 2, "i_") == 0)
+      offset = 2;
+
+    if((name.compare(offset, vChars, version) != 0) ||
+       !isHexName(name, offset + vChars, 32)){
+      continue;
+    }
+
+    struct stat buffer;
+
+    if(stat(occa::getFileLock(cachePath + name.substr(offset)).c_str(), &buffer) == 0)
+      continue;
+
+    if(remove((cachePath + name).c_str()) == 0)
+      ++removed;
+  }
+
+  return removed;
+}
+
+static int prune(int argc, char **argv){
+  uint64_t maxBytes = occa::getCacheLimit();
+
+  if(2 < argc){
+    maxBytes = occa::parseByteSize(argv[2]);
+
+    if((maxBytes == 0) && (std::string(argv[2]) != "0")){
+      std::cout << "Unknown size [" << argv[2] << "], use bytes or a K, M or G suffix\n";
+      return 1;
+    }
+  }
+  else if(maxBytes == 0){
+    std::cout << "No size given and OCCA_CACHE_SIZE is not set\n";
+    return 1;
+  }
+
+  const int unsharded   = removeUnshardedFiles(occa::getCachePath());
+  const uint64_t freed  = occa::pruneCache(maxBytes);
+
+  std::cout << "Freed " << prettyBytes(freed);
+
+  if(unsharded)
+    std::cout << ", removed " << unsharded << " files from the unsharded layout";
+
+  std::cout << '\n';
+
+  return 0;
+}
+
+// Headers in the .deps manifest that changed since [binary] was built
+static int changedDependencies(const std::string &binary){
+  std::vector<std::string> deps, hashes;
+  occa::readDependencyManifest(binary, deps, hashes);
+
+  int changed = 0;
+
+  for(size_t i = 0; i < deps.size(); ++i){
+    struct stat buffer;
+
+    if((stat(deps[i].c_str(), &buffer) != 0) ||
+       (occa::hashNormalizedFile(deps[i]) != hashes[i])){
+      ++changed;
+    }
+  }
+
+  return changed;
+}
+
+static int verify(int argc, char **argv){
+  const bool fix = ((2 < argc) && (std::string(argv[2]) == "--fix"));
+
+  const std::string cachePath = occa::getCachePath();
+  const std::string version   = std::string(occa::cacheVersion) + "_";
+
+  std::map<std::string, occa::cacheEntry> entries;
+  occa::readCacheIndex(entries);
+
+  int problems = 0;
+
+  // Binaries missing from the index
+  std::vector<std::string> shards;
+  listDirectory(cachePath, shards);
+
+  for(size_t s = 0; s < shards.size(); ++s){
+    if((shards[s].size() != 2) || !isHexName(shards[s], 0, 2))
+      continue;
+
+    std::vector<std::string> names;
+    listDirectory(cachePath + shards[s], names);
+
+    for(size_t i = 0; i < names.size(); ++i){
+      std::string name = names[i];
+
+      if((name.compare(0, version.size(), version) != 0) ||
+         !isHexName(name, version.size(), 32)){
+        continue;
+      }
+
+      // The binary, .dll on Windows, skip the .deps manifest
+      const size_t chars = version.size() + 32;
+
+      if((chars < name.size()) && (name.substr(chars) != ".dll"))
+        continue;
+
+      const std::string entryName = shards[s] + '/' + name.substr(0, chars);
+
+      if(entries.find(entryName) != entries.end())
+        continue;
+
+      ++problems;
+      std::cout << "Unindexed : " << entryName << '\n';
+
+      occa::cacheEntry &entry = entries[entryName];
+
+      entry.name    = entryName;
+      entry.lastUse = (int64_t) time(NULL);
+    }
+  }
+
+  std::vector<std::string> stale;
+
+  std::map<std::string, occa::cacheEntry>::iterator it = entries.begin();
+
+  while(it != entries.end()){
+    occa::cacheEntry &entry  = it->second;
+    const std::string binary = cachePath + entry.name;
+    const uint64_t bytes     = occa::getCacheEntryBytes(binary);
+
+    if(entry.bytes != bytes){
+      ++problems;
+      std::cout << "Size      : " << entry.name << " is " << bytes
+                << " bytes, indexed as " << entry.bytes << '\n';
+
+      entry.bytes = bytes;
+    }
+
+    const int changed = changedDependencies(binary);
+
+    if(changed){
+      std::cout << "Stale     : " << entry.name << ", "
+                << changed << " headers changed since it was built\n";
+
+      stale.push_back(entry.name);
+    }
+
+    ++it;
+  }
+
+  std::cout << entries.size() << " entries, " << problems << " index problems, "
+            << stale.size() << " stale entries\n";
+
+  if(!fix)
+    return (problems ? 1 : 0);
+
+  const std::string index = occa::getCacheIndex();
+
+  if(!occa::haveFile(index) && occa::waitForFile(index)){
+    std::cout << "The index is being pruned, try again\n";
+    return 1;
+  }
+
+  for(size_t i = 0; i < stale.size(); ++i){
+    std::vector<std::string> files;
+    occa::getCacheEntryFiles(cachePath + stale[i], files);
+
+    for(size_t f = 0; f < files.size(); ++f)
+      remove(files[f].c_str());
+
+    entries.erase(stale[i]);
+  }
+
+  occa::writeCacheIndex(entries);
+  occa::releaseFile(index);
+
+  std::cout << "Rewrote the index, evicted " << stale.size() << " stale entries\n";
+
+  return 0;
+}
+
+int main(int argc, char **argv){
+  const std::string command = ((1 < argc) ? argv[1] : "");
+
+  if(command == "stats")
+    return stats();
+
+  if(command == "prune")
+    return prune(argc, argv);
+
+  if(command == "verify")
+    return verify(argc, argv);
+
+  std::cout << "Usage: " << argv[0] << " stats\n"
+            << "       " << argv[0] << " prune [size]\n"
+            << "       " << argv[0] << " verify [--fix]\n";
+
+  return 1;
+}
@@ -0,0 +1,505 @@
+// Builds CPU-mode kernels for every process started with OCCA_COMPILE_SERVER
+//   set to its socket
+//
+//   occa-compile-server [socket] [jobs]
+//
+//   [socket] defaults to OCCA_COMPILE_SERVER and [jobs] to OCCA_COMPILE_JOBS
+//     (or the core count)
+//   Requests name a kernel (mode, source, function and kernelInfo) and the cached
+//     binary the requester expects, the server builds it with its own compiler
+//     setup through the kernel cache and answers once the binary is ready
+//   Requests for a binary that is already being built wait for that build
+//   Only processes of the server's user can connect (the socket is 0600 and
+//     peers are checked), nothing they send is run as a command
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <map>
+#include <deque>
+
+#include <stdio.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "occa.hpp"
+
+// Requests are dropped if they are not fully sent by then
+static const double requestSeconds = 10;
+
+static const int requestFields = 8;
+
+class compileJob {
+public:
+  std::string mode, filename, functionName, binary;
+  occa::kernelInfo info;
+
+  std::vector<int> clients;
+
+  int status;
+  std::string message;
+};
+
+// A connection still sending its request
+class clientRequest {
+public:
+  std::string buffer;
+  std::vector<std::string> fields;
+  double deadline;
+};
+
+static std::map<std::string, compileJob*> jobsByBinary;
+static std::map<int, clientRequest> requests;
+
+// Shared with the build threads
+static std::deque<compileJob*> queuedJobs, finishedJobs;
+static pthread_mutex_t jobMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t jobCond   = PTHREAD_COND_INITIALIZER;
+
+static int wakeFds[2];
+
+static std::map<std::string, occa::device> devices;
+
+static volatile sig_atomic_t stopping = 0;
+
+static void stop(int){
+  stopping = 1;
+}
+
+static int listenOn(const std::string &socketPath){
+  struct sockaddr_un address;
+
+  if(sizeof(address.sun_path) <= socketPath.size()){
+    std::cerr << "Socket path [" << socketPath << "] is too long\n";
+    return -1;
+  }
+
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  strcpy(address.sun_path, socketPath.c_str());
+
+  const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+  if(fd < 0)
+    return -1;
+
+  // A socket nobody answers on is left over from a server that died
+  if(connect(fd, (struct sockaddr*) &address, sizeof(address)) == 0){
+    std::cerr << "A server is already listening on [" << socketPath << "]\n";
+    close(fd);
+    return -1;
+  }
+
+  unlink(socketPath.c_str());
+
+  // Created owner-only, other users can't connect
+  const mode_t oldMask = umask(0177);
+  const int bound = bind(fd, (struct sockaddr*) &address, sizeof(address));
+  umask(oldMask);
+
+  if((bound != 0) ||
+     (chmod(socketPath.c_str(), 0600) != 0) ||
+     (listen(fd, 64) != 0)){
+    std::cerr << "Unable to listen on [" << socketPath << "]\n";
+    close(fd);
+    return -1;
+  }
+
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+  return fd;
+}
+
+static bool peerIsOwner(const int fd){
+#ifdef SO_PEERCRED
+  struct ucred credentials;
+  socklen_t bytes = sizeof(credentials);
+
+  if(getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &credentials, &bytes) != 0)
+    return false;
+
+  return (credentials.uid == geteuid());
+#else
+  uid_t uid;
+  gid_t gid;
+
+  if(getpeereid(fd, &uid, &gid) != 0)
+    return false;
+
+  return (uid == geteuid());
+#endif
+}
+
+static void answer(const int fd,
+                   const int status,
+                   const std::string &message){
+  std::stringstream ss;
+  ss << status;
+
+  occa::compileServer::sendField(fd, ss.str());
+  occa::compileServer::sendField(fd, message);
+
+  close(fd);
+}
+
+//---[ Builds ]-----------------------
+static void runJob(compileJob &job){
+  struct stat buffer;
+
+  std::map<std::string, occa::device>::iterator it = devices.find(job.mode);
+
+  if(it == devices.end()){
+    job.status  = 1;
+    job.message = "mode [" + job.mode + "] is not served";
+    return;
+  }
+
+  if(!occa::compileServer::buildHere(it->second,
+                                     job.filename,
+                                     job.functionName,
+                                     job.info)){
+    job.status  = 1;
+    job.message = "the build failed, see the server's output";
+    return;
+  }
+
+  // Built under another name: the requester's compiler setup differs
+  if(stat(job.binary.c_str(), &buffer) != 0){
+    job.status  = 2;
+    job.message = "the server's compiler setup gives another binary";
+    return;
+  }
+
+  job.status = 0;
+}
+
+static void* buildThread(void*){
+  pthread_mutex_lock(&jobMutex);
+
+  while(true){
+    while(queuedJobs.empty())
+      pthread_cond_wait(&jobCond, &jobMutex);
+
+    compileJob *job = queuedJobs.front();
+    queuedJobs.pop_front();
+
+    pthread_mutex_unlock(&jobMutex);
+
+    std::cout << "Building [" << job->binary << "] for "
+              << job->clients.size() << " request(s)\n";
+
+    runJob(*job);
+
+    pthread_mutex_lock(&jobMutex);
+
+    finishedJobs.push_back(job);
+
+    const char wake = 1;
+    if(write(wakeFds[1], &wake, 1) < 0){
+      // The pipe is full, the main loop is already woken up
+    }
+  }
+
+  return NULL;
+}
+
+static void queueJob(compileJob *job){
+  pthread_mutex_lock(&jobMutex);
+
+  queuedJobs.push_back(job);
+  pthread_cond_signal(&jobCond);
+
+  pthread_mutex_unlock(&jobMutex);
+}
+
+static void answerFinishedJobs(){
+  char wake[64];
+  while(0 < read(wakeFds[0], wake, sizeof(wake)))
+    /* Drain */;
+
+  pthread_mutex_lock(&jobMutex);
+
+  std::deque<compileJob*> finished;
+  finished.swap(finishedJobs);
+
+  pthread_mutex_unlock(&jobMutex);
+
+  for(size_t j = 0; j < finished.size(); ++j){
+    compileJob &job = *(finished[j]);
+
+    const int clientCount = job.clients.size();
+
+    for(int i = 0; i < clientCount; ++i)
+      answer(job.clients[i], job.status, job.message);
+
+    jobsByBinary.erase(job.binary);
+    delete &job;
+  }
+}
+//====================================
+
+
+//---[ Requests ]---------------------
+static void acceptRequests(const int listenFd){
+  while(true){
+    const int fd = accept(listenFd, NULL, NULL);
+
+    if(fd < 0)
+      return;
+
+    if(!peerIsOwner(fd)){
+      close(fd);
+      continue;
+    }
+
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+    clientRequest &request = requests[fd];
+    request.deadline = occa::currentTime() + requestSeconds;
+  }
+}
+
+// Moves whole "<bytes>\n<data>" fields out of [buffer], false on malformed
+//   or oversized fields
+static bool parseFields(clientRequest &request){
+  std::string &buffer = request.buffer;
+
+  while((int) request.fields.size() < requestFields){
+    const size_t newline = buffer.find('\n');
+
+    if(newline == std::string::npos)
+      return (buffer.size() <= 20);
+
+    if((newline == 0) || (20 < newline))
+      return false;
+
+    size_t bytes = 0;
+
+    for(size_t i = 0; i < newline; ++i){
+      if((buffer[i] < '0') || ('9' < buffer[i]))
+        return false;
+
+      bytes = (10*bytes) + (buffer[i] - '0');
+
+      if(occa::compileServer::maxFieldBytes < bytes)
+        return false;
+    }
+
+    if(buffer.size() < (newline + 1 + bytes))
+      return true;
+
+    request.fields.push_back(buffer.substr(newline + 1, bytes));
+    buffer.erase(0, newline + 1 + bytes);
+  }
+
+  return buffer.empty();
+}
+
+static void dispatch(const int fd, clientRequest &request){
+  const std::vector<std::string> &f = request.fields;
+
+  const std::string &binary = f[7];
+
+  // Sources are read from the server's directory, they need full paths
+  if(f[1].empty() || (f[1][0] != '/') || binary.empty()){
+    answer(fd, 1, "malformed request");
+    return;
+  }
+
+  std::map<std::string, compileJob*>::iterator it = jobsByBinary.find(binary);
+
+  if(it != jobsByBinary.end()){
+    it->second->clients.push_back(fd);
+    return;
+  }
+
+  struct stat buffer;
+
+  // Built since the requester looked
+  if(stat(binary.c_str(), &buffer) == 0){
+    answer(fd, 0, "");
+    return;
+  }
+
+  compileJob *job = new compileJob;
+
+  job->mode         = f[0];
+  job->filename     = f[1];
+  job->functionName = f[2];
+  job->binary       = binary;
+  job->status       = 1;
+
+  job->info.occaKeywords    = f[3];
+  job->info.header          = f[4];
+  job->info.flags           = f[5];
+  job->info.specializations = f[6];
+
+  job->clients.push_back(fd);
+
+  jobsByBinary[binary] = job;
+  queueJob(job);
+}
+
+static void readRequest(const int fd){
+  clientRequest &request = requests[fd];
+
+  char chunk[4096];
+  bool valid = true;
+
+  while(valid){
+    const ssize_t bytes = recv(fd, chunk, sizeof(chunk), 0);
+
+    if(bytes < 0){
+      if(errno == EINTR)
+        continue;
+
+      valid = ((errno == EAGAIN) || (errno == EWOULDBLOCK));
+      break;
+    }
+
+    // Closed before sending the whole request
+    if(bytes == 0){
+      valid = false;
+      break;
+    }
+
+    request.buffer.append(chunk, bytes);
+    valid = parseFields(request);
+  }
+
+  if(!valid){
+    requests.erase(fd);
+    close(fd);
+    return;
+  }
+
+  if((int) request.fields.size() == requestFields){
+    clientRequest ready = request;
+    requests.erase(fd);
+
+    dispatch(fd, ready);
+  }
+}
+
+static void dropLateRequests(){
+  const double now = occa::currentTime();
+
+  std::map<int, clientRequest>::iterator it = requests.begin();
+
+  while(it != requests.end()){
+    if(it->second.deadline < now){
+      close(it->first);
+      requests.erase(it++);
+    }
+    else
+      ++it;
+  }
+}
+//====================================
+
+
+int main(int argc, char **argv){
+  std::string socketPath;
+
+  if(1 < argc)
+    socketPath = argv[1];
+  else if(getenv("OCCA_COMPILE_SERVER") != NULL)
+    socketPath = getenv("OCCA_COMPILE_SERVER");
+
+  if(socketPath.size() == 0){
+    std::cout << "Usage: " << argv[0] << " [socket] [jobs]\n"
+              << "  [socket] defaults to OCCA_COMPILE_SERVER\n";
+    return 1;
+  }
+
+  int jobs = 0;
+
+  if(2 < argc)
+    jobs = atoi(argv[2]);
+  else if(getenv("OCCA_COMPILE_JOBS") != NULL)
+    jobs = atoi(getenv("OCCA_COMPILE_JOBS"));
+
+  if(jobs <= 0)
+    jobs = sysconf(_SC_NPROCESSORS_ONLN);
+
+  if(jobs <= 0)
+    jobs = 1;
+
+  // Builds made here must not be sent back to this server
+  unsetenv("OCCA_COMPILE_SERVER");
+
+  signal(SIGPIPE, SIG_IGN);
+  signal(SIGINT , stop);
+  signal(SIGTERM, stop);
+
+  devices["OpenMP"].setup("OpenMP", 0, 0);
+#if OCCA_PTHREADS_ENABLED
+  devices["Pthreads"].setup("Pthreads", 0, 1);
+#endif
+
+  if(pipe(wakeFds) != 0)
+    return 1;
+
+  fcntl(wakeFds[0], F_SETFL, fcntl(wakeFds[0], F_GETFL) | O_NONBLOCK);
+  fcntl(wakeFds[1], F_SETFL, fcntl(wakeFds[1], F_GETFL) | O_NONBLOCK);
+
+  const int listenFd = listenOn(socketPath);
+
+  if(listenFd < 0)
+    return 1;
+
+  for(int i = 0; i < jobs; ++i){
+    pthread_t thread;
+
+    if(pthread_create(&thread, NULL, buildThread, NULL) == 0)
+      pthread_detach(thread);
+  }
+
+  std::cout << "Building on [" << socketPath << "] with " << jobs << " job(s)\n";
+
+  while(!stopping){
+    std::vector<struct pollfd> fds(2 + requests.size());
+
+    fds[0].fd     = listenFd;
+    fds[0].events = POLLIN;
+    fds[1].fd     = wakeFds[0];
+    fds[1].events = POLLIN;
+
+    std::map<int, clientRequest>::iterator it = requests.begin();
+
+    for(int i = 2; it != requests.end(); ++it, ++i){
+      fds[i].fd     = it->first;
+      fds[i].events = POLLIN;
+    }
+
+    // Late requests are checked every second while some are pending
+    const int timeout = (requests.size() ? 1000 : -1);
+
+    if(poll(&(fds[0]), fds.size(), timeout) < 0)
+      continue;
+
+    for(size_t i = 2; i < fds.size(); ++i){
+      if(fds[i].revents)
+        readRequest(fds[i].fd);
+    }
+
+    if(fds[1].revents)
+      answerFinishedJobs();
+
+    if(fds[0].revents)
+      acceptRequests(listenFd);
+
+    dropLateRequests();
+  }
+
+  close(listenFd);
+  unlink(socketPath.c_str());
+
+  return 0;
+}
@@ -37,7 +37,7 @@ def runFromArguments(N):
     return 'switch(argumentCount){\n' + '\n'.join([runFromArgument(n + 1) for n in xrange(N)]) + '}'
 
 def runFromArgument(N):
-    return 'case ' + str(N) + ': (*kHandle)(' + ', '.join(['arguments[{0}]'.format(n) for n in xrange(N)]) + '); break;'
+    return 'case ' + str(N) + ': (*launchedHandle)(' + ', '.join(['arguments[{0}]'.format(n) for n in xrange(N)]) + '); break;'
 
 def virtualOperatorDeclarations(N):
     return '\n\n'.join([virtualOperatorDeclaration(n + 1) for n in xrange(N)])
@@ -65,8 +65,15 @@ def operatorDefinitions(mode, N):
 
 def operatorDefinition(mode, N):
     if mode == 'Base':
+        args = ' '.join(['arg' + str(n) + nlc(n, N) for n in xrange(N)])
+
         return """  void kernel::operator() (""" + ' '.join(['const kernelArg &arg' + str(n) + nlc(n, N) for n in xrange(N)]) + """){
-    (*kHandle)(""" + ' '.join(['arg' + str(n) + nlc(n, N) for n in xrange(N)]) + """);
+    const kernelArg args[] = {""" + args + """};
+
+    kernel_v *launched = launchHandle(args, """ + str(N) + """);
+
+    if(launched != NULL)
+      (*launched)(""" + args + """);
   }"""
     else:
         header = operatorDefinitionHeader(mode, N)
@@ -135,9 +142,7 @@ def pthreadOperatorDefinition(N):
 
     tmpKernel(occaKernelArgs,
               occaInnerId0, occaInnerId1, occaInnerId2,
-              """ + ',\n            '.join(['args.args[{0}].data()'.format(n) for n in xrange(N)]) + """);
-
-    delete &args;"""
+              """ + ',\n            '.join(['args.args[{0}].data()'.format(n) for n in xrange(N)]) + """);"""
 
 def ompOperatorDefinition(N):
     return """
@@ -0,0 +1,241 @@
+// Re-runs a launch saved with OCCA_CAPTURE=<kernel>[:<launch>]
+//
+//   occa-replay <capture> [--mode <mode>] [--repeat <count>] [--source <file>]
+//
+//   --mode    OpenMP or Pthreads, defaults to the captured mode when it runs
+//               on the host (OpenMP otherwise)
+//   --repeat  Timed launches (defaults to 10), every launch starts from the
+//               captured buffers
+//   --source  Kernel source to build instead of the captured one, relative
+//               includes still resolve from the captured kernel's directory
+//
+//   The kernel and the headers it included are rebuilt from the copies in the
+//     capture, written under <capture>.files/ with their original paths
+//
+//   Buffer checksums after the first launch tell whether an edited kernel
+//     still computes the same results
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+
+#include <sys/stat.h>
+
+#include "occa.hpp"
+
+static std::string directoryOf(const std::string &filename){
+  const size_t slash = filename.rfind('/');
+
+  return ((slash == std::string::npos) ? "." : filename.substr(0, slash));
+}
+
+// Writes [contents] to [filename], making its directories
+static void writeCopy(const std::string &filename,
+                      const std::string &contents){
+  for(size_t slash = filename.find('/', 1);
+      slash != std::string::npos;
+      slash = filename.find('/', slash + 1)){
+    mkdir(filename.substr(0, slash).c_str(), 0755);
+  }
+
+  std::ofstream fs(filename.c_str(), std::ios::out | std::ios::binary);
+  fs.write(contents.c_str(), contents.size());
+}
+
+// Drops the -I directories from [flags], the copies are used instead
+static std::string withoutIncludeDirs(const std::string &flags){
+  std::stringstream ss(flags);
+  std::string token, kept;
+
+  while(ss >> token){
+    if(token.compare(0, 2, "-I") != 0)
+      kept += (kept.size() ? " " : "") + token;
+    else if(token.size() == 2)
+      ss >> token;
+  }
+
+  return kept;
+}
+
+static void replaceAll(std::string &str,
+                       const std::string &from,
+                       const std::string &to){
+  for(size_t pos = str.find(from);
+      pos != std::string::npos;
+      pos = str.find(from, pos + to.size())){
+    str.replace(pos, from.size(), to);
+  }
+}
+
+static void restoreBuffers(const occa::captureRecord &record,
+                           std::vector<occa::memory> &buffers){
+  const int argCount = record.args.size();
+
+  for(int i = 0; i < argCount; ++i){
+    const occa::capturedArg &arg = record.args[i];
+
+    if((arg.type == occa::capturedArg::buffer) && arg.bytes.size())
+      buffers[i].copyFrom(arg.bytes.c_str(), arg.bytes.size());
+  }
+}
+
+int main(int argc, char **argv){
+  std::string captureFile, mode, source;
+  int repetitions = 10;
+
+  for(int i = 1; i < argc; ++i){
+    const std::string arg = argv[i];
+
+    if((arg == "--mode") && ((i + 1) < argc))
+      mode = argv[++i];
+    else if((arg == "--repeat") && ((i + 1) < argc))
+      repetitions = atoi(argv[++i]);
+    else if((arg == "--source") && ((i + 1) < argc))
+      source = argv[++i];
+    else if(captureFile.size() == 0)
+      captureFile = arg;
+    else
+      captureFile = "";
+  }
+
+  if(captureFile.size() == 0){
+    std::cout << "Usage: " << argv[0] << " <capture> [--mode <mode>] [--repeat <count>]"
+              << " [--source <file>]\n";
+    return 1;
+  }
+
+  occa::captureRecord record;
+
+  if(!record.load(captureFile)){
+    std::cout << "Unable to read capture [" << captureFile << "]\n";
+    return 1;
+  }
+
+  if(mode.size() == 0)
+    mode = (((record.mode == "OpenMP") || (record.mode == "Pthreads")) ? record.mode : "OpenMP");
+
+  if((mode != "OpenMP") && (mode != "Pthreads")){
+    std::cout << "Captures are replayed in OpenMP or Pthreads mode\n";
+    return 1;
+  }
+
+  // Captured paths are absolute, they are mirrored under [copies]
+  const std::string copies = occa::getCanonicalPath(directoryOf(captureFile)) + '/'
+    + captureFile.substr(captureFile.rfind('/') + 1) + ".files";
+
+  if(source.size() == 0){
+    source = copies + record.filename;
+    writeCopy(source, record.source);
+  }
+
+  const int includeCount = record.includes.size();
+
+  for(int i = 0; i < includeCount; ++i)
+    writeCopy(copies + record.includes[i], record.includeSources[i]);
+
+  std::cout << "Replaying [" << record.functionName << "] from [" << source << "] in "
+            << mode << " (captured in " << record.mode << ")\n";
+
+  occa::device dev;
+  dev.setup(mode, 0, 0);
+
+  occa::kernelInfo info = record.getKernelInfo();
+
+  info.flags = withoutIncludeDirs(info.flags);
+  info.addCompilerFlag("-I" + copies + directoryOf(record.filename));
+
+  for(size_t i = 0; i < record.includeDirs.size(); ++i)
+    info.addCompilerFlag("-I" + copies + record.includeDirs[i]);
+
+  // Headers included by absolute path from the kernelInfo header
+  for(int i = 0; i < includeCount; ++i)
+    replaceAll(info.header, '"' + record.includes[i] + '"', '"' + copies + record.includes[i] + '"');
+
+  occa::kernel ker = dev.buildKernelFromSource(source, record.functionName, info);
+
+  ker.setWorkingDims(record.dims, record.inner, record.outer);
+
+  const int argCount = record.args.size();
+
+  std::vector<occa::memory> buffers(argCount);
+
+  for(int i = 0; i < argCount; ++i){
+    const occa::capturedArg &arg = record.args[i];
+
+    if(arg.type == occa::capturedArg::buffer)
+      buffers[i] = dev.malloc(std::max((size_t) 1, arg.bytes.size()));
+    else if(arg.type == occa::capturedArg::alias)
+      buffers[i] = buffers[arg.aliasOf];
+  }
+
+  ker.clearArgumentList();
+
+  for(int i = 0; i < argCount; ++i){
+    const occa::capturedArg &arg = record.args[i];
+
+    if((arg.type == occa::capturedArg::buffer) ||
+       (arg.type == occa::capturedArg::alias)){
+      ker.addArgument(i, buffers[i]);
+    }
+    else if(arg.type == occa::capturedArg::pointer){
+      std::cout << "Argument " << i << " was a raw pointer, it is replayed as NULL\n";
+      ker.addArgument(i, occa::kernelArg((void*) NULL));
+    }
+    else{
+      occa::kernelArg_t value;
+      value.void_ = NULL;
+
+      memcpy(&value, arg.bytes.c_str(), std::min(sizeof(value), arg.bytes.size()));
+
+      ker.addArgument(i, occa::kernelArg(value, arg.bytes.size(), false));
+    }
+  }
+
+  double total = 0, fastest = 0;
+
+  for(int r = 0; r < std::max(1, repetitions); ++r){
+    restoreBuffers(record, buffers);
+    dev.finish();
+
+    const double start = occa::currentTime();
+
+    ker.runFromArguments();
+    dev.finish();
+
+    const double seconds = occa::currentTime() - start;
+
+    total  += seconds;
+    fastest = ((r == 0) ? seconds : std::min(fastest, seconds));
+
+    if(r)
+      continue;
+
+    for(int i = 0; i < argCount; ++i){
+      if(record.args[i].type != occa::capturedArg::buffer)
+        continue;
+
+      std::string contents(record.args[i].bytes.size(), '\0');
+
+      if(contents.size())
+        buffers[i].copyTo(&(contents[0]), contents.size());
+
+      std::cout << "  Argument " << i << " checksum: " << occa::hashString(contents)
+                << ((contents == record.args[i].bytes) ? " (unchanged)" : "") << '\n';
+    }
+  }
+
+  std::cout << std::setprecision(6)
+            << "  Fastest : " << fastest << " s\n"
+            << "  Average : " << (total / std::max(1, repetitions)) << " s\n";
+
+  for(int i = 0; i < argCount; ++i){
+    if(record.args[i].type == occa::capturedArg::buffer)
+      buffers[i].free();
+  }
+
+  ker.free();
+  dev.free();
+
+  return 0;
+}
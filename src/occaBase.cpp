@@ -1,5 +1,12 @@
+#include <deque>
+#include <algorithm>
+
 #include "occa.hpp"
 
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+#  include <pthread.h>
+#endif
+
 // Use events for timing!
 
 namespace occa {
@@ -11,6 +18,59 @@ namespace occa {
 
   const char* deviceInfo::dLine1 = "+--------------------------------------------------------+";
   const char* deviceInfo::dLine2 = "+  -  -  -  -  -  +  -  -  -  -  -  -  -  -  -  -  -  -  +";
+
+  // Splits [text] over as many label rows as the detailed info needs
+  static void addLabel(deviceInfo &dInfo,
+                       const std::string &label,
+                       const std::string &text){
+    std::stringstream ss(text);
+    std::string word, line, name = label;
+
+    while(ss >> word){
+      if(line.size() && (36 < (line.size() + 1 + word.size()))){
+        dInfo.labels.push_back(name);
+        dInfo.labelInfo.push_back(line);
+
+        name = "";
+        line = "";
+      }
+
+      line += (line.size() ? " " : "") + word;
+    }
+
+    if(line.size() || name.size()){
+      dInfo.labels.push_back(name);
+      dInfo.labelInfo.push_back(line);
+    }
+  }
+
+  deviceInfo hostDeviceInfo(const occa::mode m,
+                            const std::string &compilerFlags){
+    deviceInfo dInfo;
+
+    // "<model> (<cores> cores)"
+    const std::string fingerprint = getMachineFingerprint();
+    const size_t coresPos         = fingerprint.rfind(" (");
+
+    if(0 < coresPos)
+      dInfo.name = fingerprint.substr(0, coresPos);
+
+    dInfo.info = (CPU | m);
+
+#if OCCA_OS == LINUX_OS
+    dInfo.memoryGB = (sysconf(_SC_PHYS_PAGES) * (double) sysconf(_SC_PAGESIZE)) / (1 << 30);
+#endif
+
+    if(dInfo.name.find("Intel") != std::string::npos)
+      dInfo.info |= Intel;
+    else if(dInfo.name.find("AMD") != std::string::npos)
+      dInfo.info |= AMD;
+
+    addLabel(dInfo, "ISA"   , getCpuIsa());
+    addLabel(dInfo, "Flags" , compilerFlags);
+
+    return dInfo;
+  }
   //==================================
 
   //---[ Kernel ]---------------------
@@ -40,6 +100,7 @@ namespace occa {
   kernel& kernel::buildFromSource(const std::string &filename,
                                   const std::string &functionName_,
                                   const kernelInfo &info_){
+    wait();
     kHandle->buildFromSource(filename, functionName_, info_);
 
     return *this;
@@ -47,6 +108,7 @@ namespace occa {
 
   kernel& kernel::buildFromBinary(const std::string &filename,
                                   const std::string &functionName_){
+    wait();
     kHandle->buildFromBinary(filename, functionName_);
 
     return *this;
@@ -67,9 +129,21 @@ namespace occa {
   }
 
   int kernel::preferredDimSize(){
+    wait();
+
+    if(kHandle->tunedDims)
+      return kHandle->tunedInner.x;
+
     return kHandle->preferredDimSize();
   }
 
+  int kernel::tunedInnerDims(dim &inner){
+    if(kHandle->tunedDims)
+      inner = kHandle->tunedInner;
+
+    return kHandle->tunedDims;
+  }
+
   void kernel::clearArgumentList(){
     argumentCount = 0;
   }
@@ -86,6 +160,11 @@ namespace occa {
   }
 
   void kernel::runFromArguments(){
+    kernel_v *launchedHandle = launchHandle(arguments, argumentCount);
+
+    if(launchedHandle == NULL)
+      return;
+
     // [-] OCCA_MAX_ARGS = 25
 #include "operators/occaRunFromArguments.cpp"
 
@@ -95,17 +174,1096 @@ namespace occa {
 #include "operators/occaOperatorDefinitions.cpp"
 
   double kernel::timeTaken(){
-    return kHandle->timeTaken();
+    return lastLaunchedHandle(kHandle)->timeTaken();
   }
 
   void kernel::free(){
+    freeKernelVariants(kHandle);
+    freeKernelProfile(kHandle);
+    freeKernelCapture(kHandle);
+
+    // Failed asynchronous builds have nothing to free
+    if(!finishKernelBuild(kHandle, true)){
+      delete kHandle;
+      return;
+    }
+
+    // Memoized kernels share their build, the registry frees it
+    if(releaseCachedKernel(kHandle)){
+      delete kHandle;
+      return;
+    }
+
     kHandle->free();
     delete kHandle;
   }
   //==================================
 
 
+  //---[ Kernel Cache ]---------------
+  // Kernels built from source in this process, keyed by device, file and salt
+  //   Each build gets its own handle sharing the compiled data
+  class cachedKernel {
+  public:
+    std::string key;
+    kernel_v *kHandle;
+    int refs;
+  };
+
+  static std::map<std::string, cachedKernel*> cachedKernels;
+  static std::map<void*, cachedKernel*> cachedKernelData;
+
+  // Async builds register and release kernels from other threads
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+  static pthread_mutex_t cachedKernelMutex = PTHREAD_MUTEX_INITIALIZER;
+
+  static inline void lockKernelCache(){
+    pthread_mutex_lock(&cachedKernelMutex);
+  }
+
+  static inline void unlockKernelCache(){
+    pthread_mutex_unlock(&cachedKernelMutex);
+  }
+#else
+  static inline void lockKernelCache(){}
+  static inline void unlockKernelCache(){}
+#endif
+
+  // Kernels cached for a freed device are never matched by later devices
+  static uintptr_t newDeviceCacheId(){
+    static uintptr_t nextId = 0;
+
+    lockKernelCache();
+    const uintptr_t id = nextId++;
+    unlockKernelCache();
+
+    return id;
+  }
+
+  // Adds a reference to the kernel cached under [key], the handle stays valid until released
+  static kernel_v* findCachedKernel(const std::string &key){
+    if(key.size() == 0)
+      return NULL;
+
+    kernel_v *k = NULL;
+
+    lockKernelCache();
+
+    std::map<std::string, cachedKernel*>::iterator it = cachedKernels.find(key);
+
+    if(it != cachedKernels.end()){
+      ++(it->second->refs);
+      k = it->second->kHandle;
+    }
+
+    unlockKernelCache();
+
+    return k;
+  }
+
+  // [entryHandle] shares [data], it is deleted if the key was cached meanwhile
+  static void addCachedKernel(const std::string &key,
+                              void *data,
+                              kernel_v *entryHandle){
+    lockKernelCache();
+
+    const bool added = (cachedKernels.find(key) == cachedKernels.end());
+
+    if(added){
+      cachedKernel *entry = new cachedKernel;
+
+      entry->key     = key;
+      entry->kHandle = entryHandle;
+      entry->refs    = 1;
+
+      cachedKernels[key]              = entry;
+      cachedKernelData[data]          = entry;
+    }
+
+    unlockKernelCache();
+
+    if(!added)
+      delete entryHandle;
+  }
+
+  static kernel_v* newKernelHandle(const occa::mode m){
+    switch(m){
+#if OCCA_PTHREADS_ENABLED
+    case Pthreads: return new kernel_t<Pthreads>;
+#endif
+    case OpenMP:   return new kernel_t<OpenMP>;
+#if OCCA_OPENCL_ENABLED
+    case OpenCL:   return new kernel_t<OpenCL>;
+#endif
+#if OCCA_CUDA_ENABLED
+    case CUDA:     return new kernel_t<CUDA>;
+#endif
+#if OCCA_COI_ENABLED
+    case COI:      return new kernel_t<COI>;
+#endif
+    }
+
+    return NULL;
+  }
+
+  kernel_v* device::cloneKernelHandle(kernel_v *kHandle_){
+    kernel_v *k = newKernelHandle(mode_);
+
+    k->data              = kHandle_->data;
+    k->dev               = this;
+    k->functionName      = kHandle_->functionName;
+    k->preferredDimSize_ = kHandle_->preferredDimSize_;
+
+    return k;
+  }
+
+  std::string device::cachedKernelKey(const std::string &filename,
+                                      const std::string &functionName,
+                                      const kernelInfo &info_){
+    const std::string path = getCanonicalPath(filename);
+
+    struct stat fileInfo;
+
+    if(stat(path.c_str(), &fileInfo) != 0)
+      return "";
+
+    std::stringstream key;
+
+    key << dHandle->cacheId           << '\n'
+        << path                       << '\n'
+        << fileInfo.st_mtime          << '.'
+#if (OCCA_OS == OSX_OS)
+        << fileInfo.st_mtimespec.tv_nsec << '\n'
+#elif (OCCA_OS == LINUX_OS)
+        << fileInfo.st_mtim.tv_nsec   << '\n'
+#else
+        << '\n'
+#endif
+        << fileInfo.st_size           << '\n'
+        << functionName               << '\n'
+        << dHandle->compilerEnvScript << '\n'
+        << dHandle->compiler          << '\n'
+        << dHandle->compilerFlags     << '\n'
+        << info_.salt();
+
+    return key.str();
+  }
+
+  bool releaseCachedKernel(kernel_v *kHandle){
+    lockKernelCache();
+
+    std::map<void*, cachedKernel*>::iterator it = cachedKernelData.find(kHandle->data);
+
+    if(it == cachedKernelData.end()){
+      unlockKernelCache();
+      return false;
+    }
+
+    cachedKernel *entry = it->second;
+
+    if(--(entry->refs) != 0){
+      unlockKernelCache();
+      return true;
+    }
+
+    cachedKernels.erase(entry->key);
+    cachedKernelData.erase(it);
+
+    unlockKernelCache();
+
+    entry->kHandle->free();
+    delete entry->kHandle;
+    delete entry;
+
+    return true;
+  }
+  //==================================
+
+
+  //---[ Async Builds ]---------------
+  // Builds from device::buildKernelFromSourceAsync run on a bounded pool of
+  //   detached threads, a kernel waits for its build on first use
+  //   (queued builds are taken over by the waiting thread)
+  class kernelBuild {
+  public:
+    kernel_v *kHandle;
+    device_v *dHandle;
+
+    std::string filename, functionName, cacheKey;
+    kernelInfo info;
+    kernelInfo plainInfo; // Built instead if the profile flags in [info] fail
+
+    int state;
+    bool failed;
+
+    void run();
+    void registerKernel();
+  };
+
+  static const int buildQueued  = 0;
+  static const int buildRunning = 1;
+  static const int buildDone    = 2;
+  static const int buildLazy    = 3; // Not queued until used or prefetched
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+  static std::deque<kernelBuild*> buildQueue;
+  static int buildWorkers = 0;
+
+  static pthread_mutex_t buildMutex = PTHREAD_MUTEX_INITIALIZER;
+  static pthread_cond_t buildCond   = PTHREAD_COND_INITIALIZER;
+
+  static int compileJobs(){
+    static int jobs = 0;
+
+    if(jobs == 0){
+      char *c_jobs = getenv("OCCA_COMPILE_JOBS");
+
+      if(c_jobs != NULL)
+        jobs = atoi(c_jobs);
+
+      if(jobs <= 0)
+        jobs = sysconf(_SC_NPROCESSORS_ONLN);
+
+      if(jobs <= 0)
+        jobs = 1;
+    }
+
+    return jobs;
+  }
+#endif
+
+  void kernelBuild::run(){
+    kernel_v *built = NULL;
+
+    try {
+      built = dHandle->buildKernelFromSource(filename, functionName, info);
+    }
+    catch(...){
+      built = NULL;
+    }
+
+    // Compilers that reject -dumpdir or -fprofile-update=prefer-atomic (GCC
+    //   before 11, clang) or lack libgcov's __gcov_dump build it plainly
+    const bool plainBuild = ((built == NULL) && (plainInfo.flags != info.flags));
+
+    if(plainBuild){
+      std::cout << "Profiled build of [" << functionName << "] failed, "
+                << "building it without profiling\n";
+
+      try {
+        built = dHandle->buildKernelFromSource(filename, functionName, plainInfo);
+      }
+      catch(...){
+        built = NULL;
+      }
+
+      // Waiters only read [kHandle] once the build is done
+      freeKernelProfile(kHandle);
+      cacheKey = "";
+    }
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    pthread_mutex_lock(&buildMutex);
+#endif
+
+    // Launch dimensions may have been set on [kHandle] in the meantime
+    if(built != NULL){
+      kHandle->data              = built->data;
+      kHandle->functionName      = built->functionName;
+      kHandle->preferredDimSize_ = built->preferredDimSize_;
+
+      delete built;
+    }
+
+    failed = (built == NULL);
+    state  = buildDone;
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    pthread_cond_broadcast(&buildCond);
+    pthread_mutex_unlock(&buildMutex);
+#endif
+  }
+
+  // Done from the waiting thread
+  void kernelBuild::registerKernel(){
+    if(cacheKey.size())
+      addCachedKernel(cacheKey, kHandle->data, kHandle->dev->cloneKernelHandle(kHandle));
+  }
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+  static void* compileWorker(void *args){
+    pthread_mutex_lock(&buildMutex);
+
+    while(buildQueue.size()){
+      kernelBuild *b = buildQueue.front();
+      buildQueue.pop_front();
+
+      b->state = buildRunning;
+
+      pthread_mutex_unlock(&buildMutex);
+      b->run();
+      pthread_mutex_lock(&buildMutex);
+    }
+
+    --buildWorkers;
+
+    pthread_mutex_unlock(&buildMutex);
+
+    return NULL;
+  }
+#endif
+
+  static void queueKernelBuild(kernelBuild *b){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    pthread_mutex_lock(&buildMutex);
+
+    buildQueue.push_back(b);
+
+    if(buildWorkers < compileJobs()){
+      pthread_t thread;
+
+      // Without a worker the build is run on first use
+      if(pthread_create(&thread, NULL, compileWorker, NULL) == 0){
+        pthread_detach(thread);
+        ++buildWorkers;
+      }
+    }
+
+    pthread_mutex_unlock(&buildMutex);
+#else
+    b->state = buildRunning;
+    b->run();
+#endif
+  }
+
+  bool finishKernelBuild(kernel_v *kHandle, const bool discard){
+    kernelBuild *b = kHandle->build;
+
+    if(b == NULL)
+      return true;
+
+    // Lazy kernels freed before their first launch are never compiled
+    if(discard && (b->state == buildLazy)){
+      kHandle->build = NULL;
+      delete b;
+
+      return false;
+    }
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    pthread_mutex_lock(&buildMutex);
+
+    if((b->state == buildQueued) || (b->state == buildLazy)){
+      if(b->state == buildQueued)
+        buildQueue.erase(std::find(buildQueue.begin(), buildQueue.end(), b));
+
+      b->state = buildRunning;
+
+      pthread_mutex_unlock(&buildMutex);
+      b->run();
+      pthread_mutex_lock(&buildMutex);
+    }
+
+    while(b->state != buildDone)
+      pthread_cond_wait(&buildCond, &buildMutex);
+
+    pthread_mutex_unlock(&buildMutex);
+#else
+    if(b->state == buildLazy){
+      b->state = buildRunning;
+      b->run();
+    }
+#endif
+
+    if(b->failed){
+      if(discard){
+        kHandle->build = NULL;
+        delete b;
+      }
+
+      return false;
+    }
+
+    kHandle->build = NULL;
+
+    b->registerKernel();
+
+    delete b;
+
+    return true;
+  }
+
+  bool kernel::isReady(){
+    kernelBuild *b = kHandle->build;
+
+    if(b == NULL)
+      return true;
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    pthread_mutex_lock(&buildMutex);
+    const bool done = (b->state == buildDone);
+    pthread_mutex_unlock(&buildMutex);
+
+    return done;
+#else
+    return true;
+#endif
+  }
+
+  void kernel::prefetch(){
+    kernelBuild *b = kHandle->build;
+
+    // Only this kernel's owner touches a lazy build, no lock is needed yet
+    if((b == NULL) || (b->state != buildLazy))
+      return;
+
+    b->state = buildQueued;
+    queueKernelBuild(b);
+  }
+
+  void kernel::wait(){
+    if(kHandle->build == NULL)
+      return;
+
+    if(!finishKernelBuild(kHandle)){
+      std::cout << "Asynchronous build of [" << kHandle->functionName << "] failed\n";
+      throw 1;
+    }
+  }
+  //==================================
+
+
+  //---[ Kernel Variants ]------------
+  // Variants are keyed by the bytes of the specialized arguments at launch
+  //   and built with device::buildKernelFromSourceAsync (the cached binary
+  //   is reused across runs), failed builds are kept without a handle
+  class kernelVariants {
+  public:
+    std::string filename, functionName;
+    kernelInfo info;
+
+    std::vector<int> argPositions;
+    std::vector<std::string> argNames, argTypes;
+
+    std::map<std::string, kernel> variants;
+    kernel_v *lastLaunch;
+
+    static void attach(kernel_v *kHandle,
+                       const std::string &filename,
+                       const std::string &functionName,
+                       const kernelInfo &info_);
+  };
+
+  static const int notSpecializable = 0;
+  static const int signedType       = 1;
+  static const int unsignedType     = 2;
+  static const int floatType        = 3;
+  static const int doubleType       = 4;
+
+  static int getSpecializedType(const std::string &type){
+    if(type.find('*') != std::string::npos)
+      return notSpecializable;
+
+    std::stringstream ss(type);
+    std::string token;
+
+    int ret = signedType;
+
+    while(ss >> token){
+      if((token == "const")     || (token == "occaConst")    ||
+         (token == "&")         || (token == "occaVariable") ||
+         (token == "signed")    || (token == "int")          ||
+         (token == "char")      || (token == "short")        ||
+         (token == "long")      || (token == "bool")){
+        continue;
+      }
+
+      if((token == "unsigned") || (token == "uint")   ||
+         (token == "uchar")    || (token == "ushort") ||
+         (token == "size_t")   || (token == "uintptr_t")){
+        ret = unsignedType;
+      }
+      else if(token == "float")
+        ret = floatType;
+      else if(token == "double")
+        ret = doubleType;
+      else
+        return notSpecializable;
+    }
+
+    return ret;
+  }
+
+  // Returns "" if [arg] can't be written as a [type] constant
+  static std::string getSpecializedValue(const std::string &type,
+                                         const kernelArg &arg){
+    const int valueType = getSpecializedType(type);
+
+    if(arg.pointer || (valueType == notSpecializable))
+      return "";
+
+    std::stringstream ss;
+
+    if(valueType == floatType){
+      if((arg.size != sizeof(float)) || (arg.arg.float_ != arg.arg.float_))
+        return "";
+
+      ss << "((float) " << std::setprecision(9) << arg.arg.float_ << ')';
+    }
+    else if(valueType == doubleType){
+      if((arg.size != sizeof(double)) || (arg.arg.double_ != arg.arg.double_))
+        return "";
+
+      ss << "((double) " << std::setprecision(17) << arg.arg.double_ << ')';
+    }
+    else{
+      const bool isSigned = (valueType == signedType);
+
+      switch(arg.size){
+      case 1:
+        if(isSigned) ss << (int) arg.arg.char_;
+        else         ss << (int) arg.arg.uchar_ << 'u';
+        break;
+      case 2:
+        if(isSigned) ss << arg.arg.short_;
+        else         ss << arg.arg.ushort_ << 'u';
+        break;
+      case 4:
+        if(isSigned) ss << arg.arg.int_;
+        else         ss << arg.arg.uint_ << 'u';
+        break;
+      case 8:
+        if(isSigned) ss << (int64_t) arg.arg.uintptr_t_ << "ll";
+        else         ss << (uint64_t) arg.arg.uintptr_t_ << "ull";
+        break;
+      default:
+        return "";
+      }
+    }
+
+    // Infinities have no literal
+    const std::string value = ss.str();
+
+    if(value.find("inf") != std::string::npos)
+      return "";
+
+    return value;
+  }
+
+  void kernelVariants::attach(kernel_v *kHandle,
+                              const std::string &filename,
+                              const std::string &functionName,
+                              const kernelInfo &info_){
+    const int specializedCount = info_.specializedArgs.size();
+
+    if((specializedCount == 0) || (kHandle->variants != NULL))
+      return;
+
+    std::vector<std::string> names, types;
+
+    if(!getKernelArguments(readFile(filename), functionName, names, types)){
+      std::cout << "Could not read the arguments of [" << functionName << "], "
+                << "its arguments are not specialized\n";
+      return;
+    }
+
+    kernelVariants *kv = new kernelVariants;
+
+    kv->filename     = filename;
+    kv->functionName = functionName;
+    kv->info         = info_;
+    kv->lastLaunch   = kHandle;
+
+    kv->info.specializedArgs.clear();
+
+    for(int i = 0; i < specializedCount; ++i){
+      const std::string &argName = info_.specializedArgs[i];
+      const int argCount = names.size();
+
+      int pos = 0;
+
+      while((pos < argCount) && (names[pos] != argName))
+        ++pos;
+
+      if((pos == argCount) || (getSpecializedType(types[pos]) == notSpecializable)){
+        std::cout << "Kernel [" << functionName << "] has no scalar argument ["
+                  << argName << "] to specialize\n";
+        continue;
+      }
+
+      kv->argPositions.push_back(pos);
+      kv->argNames.push_back(argName);
+      kv->argTypes.push_back(types[pos]);
+    }
+
+    if(kv->argPositions.size() == 0){
+      delete kv;
+      return;
+    }
+
+    kHandle->variants = kv;
+  }
+
+  void freeKernelVariants(kernel_v *kHandle){
+    kernelVariants *kv = kHandle->variants;
+
+    if(kv == NULL)
+      return;
+
+    std::map<std::string, kernel>::iterator it = kv->variants.begin();
+
+    while(it != kv->variants.end()){
+      kernel &variant = it->second;
+
+      // Waits for builds still in flight
+      if(variant.kHandle != NULL)
+        variant.free();
+
+      ++it;
+    }
+
+    delete kv;
+
+    kHandle->variants = NULL;
+  }
+
+  kernel_v* lastLaunchedHandle(kernel_v *kHandle){
+    if(kHandle->variants == NULL)
+      return kHandle;
+
+    return kHandle->variants->lastLaunch;
+  }
+
+  kernel_v* kernel::variantHandle(const kernelArg *args,
+                                  const int argCount){
+    wait();
+
+    kernelVariants *kv = kHandle->variants;
+
+    if(kv == NULL)
+      return kHandle;
+
+    kv->lastLaunch = kHandle;
+
+    const int specializedCount = kv->argPositions.size();
+
+    std::string key;
+
+    for(int i = 0; i < specializedCount; ++i){
+      const int pos = kv->argPositions[i];
+
+      if(argCount <= pos)
+        return kHandle;
+
+      key.append((const char*) &(args[pos].arg), args[pos].size);
+    }
+
+    std::map<std::string, kernel>::iterator it = kv->variants.find(key);
+
+    if(it == kv->variants.end()){
+      if(kv->info.maxVariants <= (int) kv->variants.size())
+        return kHandle;
+
+      kernelInfo variantInfo = kv->info;
+
+      for(int i = 0; i < specializedCount; ++i){
+        const std::string value = getSpecializedValue(kv->argTypes[i],
+                                                      args[kv->argPositions[i]]);
+
+        // Kept as a failed variant, the generic kernel handles this value
+        if(value.size() == 0){
+          kv->variants[key] = kernel();
+          return kHandle;
+        }
+
+        variantInfo.addSpecialization(kv->argNames[i], value);
+      }
+
+      kv->variants[key] = kHandle->dev->buildKernelFromSourceAsync(kv->filename,
+                                                                   kv->functionName,
+                                                                   variantInfo);
+      return kHandle;
+    }
+
+    kernel &variant = it->second;
+
+    if((variant.kHandle == NULL) || !variant.isReady())
+      return kHandle;
+
+    if(!finishKernelBuild(variant.kHandle)){
+      std::cout << "Specialized build of [" << kHandle->functionName << "] failed, "
+                << "using the generic kernel for its values\n";
+
+      variant.free();
+      variant.kHandle = NULL;
+
+      return kHandle;
+    }
+
+    kernel_v *vHandle = variant.kHandle;
+
+    vHandle->dims  = kHandle->dims;
+    vHandle->inner = kHandle->inner;
+    vHandle->outer = kHandle->outer;
+
+    kv->lastLaunch = vHandle;
+
+    return vHandle;
+  }
+  //==================================
+
+
+  //---[ Profile-Guided Builds ]------
+  // OCCA_PGO=<launches> builds CPU-mode kernels with -fprofile-generate,
+  //   after [launches] launches the instrumented binary dumps its profile and
+  //   the kernel is rebuilt with -fprofile-use on the asynchronous build pool
+  //   The instrumented binary keeps running until the rebuild is done
+  //
+  // Profiles live in [cachePath]/pgo/<hash>/, a finished profile is moved
+  //   out of run/ so later runs build (or find) the optimized binary directly
+  class kernelProfile {
+  public:
+    std::string filename, functionName;
+    kernelInfo info, optimizedInfo;
+    std::string profileDir;
+    int launchesLeft;
+
+    kernel_v *rebuild; // Replacement being built
+    bool optimizing;   // [rebuild] uses the profile, a plain rebuild follows if it fails
+
+    // Adds the profile flags to [info], returns the profile to collect
+    //   if there is no finished one yet
+    static kernelProfile* start(device_v *dHandle,
+                                const occa::mode mode_,
+                                const std::string &filename,
+                                const std::string &functionName,
+                                kernelInfo &info);
+
+    static void launched(kernel_v *kHandle);
+
+    static kernel_v* queueRebuild(kernel_v *kHandle,
+                                  const kernelInfo &rebuildInfo);
+
+    static bool rebuildDone(kernel_v *rebuild);
+    static void discardRebuild(kernel_v *rebuild);
+  };
+
+  static const char profileName[] = "occaKernel";
+
+  // Added to instrumented sources, writes the profile without unloading the binary
+  //   (libgcov skips the dump at unload afterwards)
+  static const char profileDumpSource[] = "extern \"C\" void __gcov_dump(void);\n"
+                                          "extern \"C\" void occaDumpProfile(){ __gcov_dump(); }\n";
+
+  static int profileLaunches(){
+    static int launches = -1;
+
+    if(launches < 0){
+      char *c_launches = getenv("OCCA_PGO");
+
+      launches = ((c_launches != NULL) ? atoi(c_launches) : 0);
+
+      if(launches < 0)
+        launches = 0;
+    }
+
+    return launches;
+  }
+
+  static void makeProfileDirectory(const std::string &dir){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    mkdir(dir.c_str(), 0755);
+#else
+    CreateDirectoryA(dir.c_str(), NULL);
+#endif
+  }
+
+  kernelProfile* kernelProfile::start(device_v *dHandle,
+                                      const occa::mode mode_,
+                                      const std::string &filename,
+                                      const std::string &functionName,
+                                      kernelInfo &info){
+    const int launches = profileLaunches();
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    if((launches == 0) || ((mode_ != OpenMP) && (mode_ != Pthreads)))
+      return NULL;
+#else
+    // Needs a GCC-compatible compiler
+    return NULL;
+#endif
+
+    std::stringstream ss;
+
+    ss << mode_ << ' '
+       << dHandle->setupArgs[0] << ' '
+       << dHandle->setupArgs[1] << '\n'
+       << dHandle->compilerEnvScript << '\n'
+       << dHandle->compiler          << '\n'
+       << dHandle->compilerFlags     << '\n'
+       << functionName               << '\n';
+
+    hasher h;
+
+    h.update(ss.str());
+    h.update(hashNormalizedFile(filename));
+    h.update(info.salt());
+
+    const std::string pgoDir     = getCachePath() + "pgo/";
+    const std::string profileDir = pgoDir + cacheVersion + "_" + h.digest() + "/";
+    const std::string runDir     = profileDir + "run/";
+
+    kernelInfo optimizedInfo = info;
+
+    // The profile is matched by -dumpdir/-dumpbase, not by the binary's name
+    optimizedInfo.addCompilerFlag("-fprofile-use -fprofile-correction -Wno-coverage-mismatch"
+                                  " -dumpdir " + profileDir +
+                                  " -dumpbase " + profileName);
+
+    struct stat buffer;
+
+    if(stat((profileDir + profileName + ".gcda").c_str(), &buffer) == 0){
+      info = optimizedInfo;
+      return NULL;
+    }
+
+    makeProfileDirectory(pgoDir);
+    makeProfileDirectory(profileDir);
+    makeProfileDirectory(runDir);
+
+    kernelProfile *kp = new kernelProfile;
+
+    kp->filename      = filename;
+    kp->functionName  = functionName;
+    kp->info          = info;
+    kp->optimizedInfo = optimizedInfo;
+    kp->profileDir    = profileDir;
+    kp->launchesLeft  = launches;
+    kp->rebuild       = NULL;
+    kp->optimizing    = false;
+
+    // Counters are updated atomically if the target allows it (OpenMP)
+    info.addCompilerFlag("-fprofile-generate -fprofile-update=prefer-atomic"
+                         " -dumpdir " + runDir +
+                         " -dumpbase " + profileName);
+
+    info.addSource(profileDumpSource);
+
+    return kp;
+  }
+
+  kernel_v* kernelProfile::queueRebuild(kernel_v *kHandle,
+                                        const kernelInfo &rebuildInfo){
+    kernelProfile *kp = kHandle->profile;
+    kernelBuild *b    = new kernelBuild;
+
+    b->kHandle      = newKernelHandle(kHandle->dev->mode_);
+    b->dHandle      = kHandle->dev->dHandle;
+    b->filename     = kp->filename;
+    b->functionName = kp->functionName;
+    b->info         = rebuildInfo;
+    b->plainInfo    = rebuildInfo;
+    b->state        = buildQueued;
+    b->failed       = false;
+
+    b->kHandle->dev          = kHandle->dev;
+    b->kHandle->functionName = kp->functionName;
+    b->kHandle->build        = b;
+
+    queueKernelBuild(b);
+
+    return b->kHandle;
+  }
+
+  bool kernelProfile::rebuildDone(kernel_v *rebuild){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    pthread_mutex_lock(&buildMutex);
+
+    const bool done = (rebuild->build->state == buildDone);
+
+    pthread_mutex_unlock(&buildMutex);
+
+    return done;
+#else
+    return true;
+#endif
+  }
+
+  // Queued rebuilds are dropped, running ones are waited on
+  void kernelProfile::discardRebuild(kernel_v *rebuild){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    kernelBuild *b = rebuild->build;
+
+    pthread_mutex_lock(&buildMutex);
+
+    const bool queued = (b->state == buildQueued);
+
+    if(queued)
+      buildQueue.erase(std::find(buildQueue.begin(), buildQueue.end(), b));
+
+    pthread_mutex_unlock(&buildMutex);
+
+    if(queued){
+      delete b;
+      delete rebuild;
+      return;
+    }
+#endif
+
+    if(finishKernelBuild(rebuild, true))
+      rebuild->free();
+
+    delete rebuild;
+  }
+
+  void kernelProfile::launched(kernel_v *kHandle){
+    kernelProfile *kp = kHandle->profile;
+
+    if(kp->rebuild == NULL){
+      if(0 < kp->launchesLeft){
+        --(kp->launchesLeft);
+        return;
+      }
+
+      kHandle->dev->finish();
+
+      // The profile is written when the binary is unloaded instead
+      if(!kHandle->dumpProfile()){
+        kHandle->profile = NULL;
+        delete kp;
+        return;
+      }
+
+      const std::string runProfile = kp->profileDir + "run/" + profileName + ".gcda";
+      const std::string profile    = kp->profileDir + profileName + ".gcda";
+
+      kp->optimizing = (rename(runProfile.c_str(), profile.c_str()) == 0);
+
+      if(kp->optimizing)
+        std::cout << "Rebuilding [" << kp->functionName << "] with its profile\n";
+
+      kp->rebuild = queueRebuild(kHandle, (kp->optimizing
+                                           ? kp->optimizedInfo
+                                           : kp->info));
+      return;
+    }
+
+    if(!rebuildDone(kp->rebuild))
+      return;
+
+    kernel_v *rebuild = kp->rebuild;
+    kp->rebuild = NULL;
+
+    if(!finishKernelBuild(rebuild, true)){
+      delete rebuild;
+
+      // The compiler rejected the profile
+      if(kp->optimizing){
+        std::cout << "Profile-guided build of [" << kp->functionName << "] failed, "
+                  << "rebuilding it without a profile\n";
+
+        kp->optimizing = false;
+        kp->rebuild    = queueRebuild(kHandle, kp->info);
+        return;
+      }
+
+      std::cout << "Rebuilding [" << kp->functionName << "] failed, "
+                << "keeping its instrumented binary\n";
+
+      kHandle->profile = NULL;
+      delete kp;
+      return;
+    }
+
+    kHandle->profile = NULL;
+
+    // The replacement exists, the instrumented binary can go
+    kHandle->free();
+
+    kHandle->data              = rebuild->data;
+    kHandle->preferredDimSize_ = rebuild->preferredDimSize_;
+
+    delete rebuild;
+    delete kp;
+  }
+
+  void freeKernelProfile(kernel_v *kHandle){
+    kernelProfile *kp = kHandle->profile;
+
+    if(kp == NULL)
+      return;
+
+    if(kp->rebuild != NULL)
+      kernelProfile::discardRebuild(kp->rebuild);
+
+    // An unfinished profile is kept in run/ and extended by later runs
+    delete kp;
+
+    kHandle->profile = NULL;
+  }
+
+  kernel_v* kernel::launchHandle(const kernelArg *args,
+                                 const int argCount){
+    kernel_v *launched = variantHandle(args, argCount);
+
+    // Recorded into the graph instead of running
+    if(graph_v::captureLaunch(launched, args, argCount))
+      return NULL;
+
+    // Saved before the launch, buffers hold its inputs
+    if(kHandle->capture != NULL)
+      kernelCapture::launched(kHandle, args, argCount);
+
+    if(launched->profile != NULL)
+      kernelProfile::launched(launched);
+
+    return launched;
+  }
+  //==================================
+
+
   //---[ Memory ]---------------------
+  void memory_v::hostGather(memory_v *dest,
+                            const memory_v *indices,
+                            const uintptr_t entryBytes,
+                            const uintptr_t entries){
+    char *src_     = new char[size];
+    char *dest_    = new char[entries * entryBytes];
+    int *indices_  = new int[entries];
+
+    copyTo(src_);
+    ((memory_v*) indices)->copyTo(indices_, entries * sizeof(int));
+
+    occa::memGather(dest_, src_, indices_, entryBytes, entries);
+
+    dest->copyFrom(dest_, entries * entryBytes);
+
+    delete [] src_;
+    delete [] dest_;
+    delete [] indices_;
+  }
+
+  void memory_v::hostScatter(memory_v *dest,
+                             const memory_v *indices,
+                             const uintptr_t entryBytes,
+                             const uintptr_t entries){
+    char *src_     = new char[entries * entryBytes];
+    char *dest_    = new char[dest->size];
+    int *indices_  = new int[entries];
+
+    copyTo(src_, entries * entryBytes);
+    dest->copyTo(dest_);
+    ((memory_v*) indices)->copyTo(indices_, entries * sizeof(int));
+
+    occa::memScatter(dest_, src_, indices_, entryBytes, entries);
+
+    dest->copyFrom(dest_);
+
+    delete [] src_;
+    delete [] dest_;
+    delete [] indices_;
+  }
+
   memory::memory() :
     mode_(),
     strMode(""),
@@ -132,6 +1290,12 @@ namespace occa {
   void memory::copyFrom(const void *source,
                         const uintptr_t bytes,
                         const uintptr_t offset){
+    if(graph_v::captureCopy(mHandle->dev,
+                            mHandle, NULL, NULL, source,
+                            (bytes ? bytes : mHandle->size), offset, 0)){
+      return;
+    }
+
     mHandle->copyFrom(source, bytes, offset);
   }
 
@@ -139,12 +1303,24 @@ namespace occa {
                         const uintptr_t bytes,
                         const uintptr_t destOffset,
                         const uintptr_t srcOffset){
+    if(graph_v::captureCopy(mHandle->dev,
+                            mHandle, NULL, source.mHandle, NULL,
+                            (bytes ? bytes : mHandle->size), destOffset, srcOffset)){
+      return;
+    }
+
     mHandle->copyFrom(source.mHandle, bytes, destOffset, srcOffset);
   }
 
   void memory::copyTo(void *dest,
                       const uintptr_t bytes,
                       const uintptr_t offset){
+    if(graph_v::captureCopy(mHandle->dev,
+                            NULL, dest, mHandle, NULL,
+                            (bytes ? bytes : mHandle->size), 0, offset)){
+      return;
+    }
+
     mHandle->copyTo(dest, bytes, offset);
   }
 
@@ -152,12 +1328,24 @@ namespace occa {
                       const uintptr_t bytes,
                       const uintptr_t destOffset,
                       const uintptr_t srcOffset){
+    if(graph_v::captureCopy(mHandle->dev,
+                            dest.mHandle, NULL, mHandle, NULL,
+                            (bytes ? bytes : mHandle->size), destOffset, srcOffset)){
+      return;
+    }
+
     mHandle->copyTo(dest.mHandle, bytes, destOffset, srcOffset);
   }
 
   void memory::asyncCopyFrom(const void *source,
                              const uintptr_t bytes,
                              const uintptr_t offset){
+    if(graph_v::captureCopy(mHandle->dev,
+                            mHandle, NULL, NULL, source,
+                            (bytes ? bytes : mHandle->size), offset, 0)){
+      return;
+    }
+
     mHandle->asyncCopyFrom(source, bytes, offset);
   }
 
@@ -165,12 +1353,24 @@ namespace occa {
                              const uintptr_t bytes,
                              const uintptr_t destOffset,
                              const uintptr_t srcOffset){
+    if(graph_v::captureCopy(mHandle->dev,
+                            mHandle, NULL, source.mHandle, NULL,
+                            (bytes ? bytes : mHandle->size), destOffset, srcOffset)){
+      return;
+    }
+
     mHandle->asyncCopyFrom(source.mHandle, bytes, destOffset, srcOffset);
   }
 
   void memory::asyncCopyTo(void *dest,
                            const uintptr_t bytes,
                            const uintptr_t offset){
+    if(graph_v::captureCopy(mHandle->dev,
+                            NULL, dest, mHandle, NULL,
+                            (bytes ? bytes : mHandle->size), 0, offset)){
+      return;
+    }
+
     mHandle->asyncCopyTo(dest, bytes, offset);
   }
 
@@ -178,9 +1378,66 @@ namespace occa {
                            const uintptr_t bytes,
                            const uintptr_t destOffset,
                            const uintptr_t srcOffset){
+    if(graph_v::captureCopy(mHandle->dev,
+                            dest.mHandle, NULL, mHandle, NULL,
+                            (bytes ? bytes : mHandle->size), destOffset, srcOffset)){
+      return;
+    }
+
     mHandle->asyncCopyTo(dest.mHandle, bytes, destOffset, srcOffset);
   }
 
+  void memory::fill(const void *pattern,
+                    const uintptr_t patternBytes,
+                    const uintptr_t bytes,
+                    const uintptr_t offset){
+    OCCA_CHECK(patternBytes > 0);
+
+    if(graph_v::captureFill(mHandle->dev,
+                            mHandle, pattern, patternBytes,
+                            (bytes ? bytes : mHandle->size), offset)){
+      return;
+    }
+
+    mHandle->fill(pattern, patternBytes, bytes, offset);
+  }
+
+  void memory::gather(memory &dest,
+                      const memory &indices,
+                      const uintptr_t entryBytes,
+                      const uintptr_t entries){
+    OCCA_CHECK(dest.mode_ == mode_);
+    OCCA_CHECK(indices.mode_ == mode_);
+    OCCA_CHECK((entries * sizeof(int)) <= indices.bytes());
+    OCCA_CHECK((entries * entryBytes)  <= dest.bytes());
+
+    if(graph_v::captureIndexedCopy(mHandle->dev, graphNode::gather,
+                                   dest.mHandle, mHandle, indices.mHandle,
+                                   entryBytes, entries)){
+      return;
+    }
+
+    mHandle->gather(dest.mHandle, indices.mHandle, entryBytes, entries);
+  }
+
+  void memory::scatter(memory &dest,
+                       const memory &indices,
+                       const uintptr_t entryBytes,
+                       const uintptr_t entries){
+    OCCA_CHECK(dest.mode_ == mode_);
+    OCCA_CHECK(indices.mode_ == mode_);
+    OCCA_CHECK((entries * sizeof(int)) <= indices.bytes());
+    OCCA_CHECK((entries * entryBytes)  <= bytes());
+
+    if(graph_v::captureIndexedCopy(mHandle->dev, graphNode::scatter,
+                                   dest.mHandle, mHandle, indices.mHandle,
+                                   entryBytes, entries)){
+      return;
+    }
+
+    mHandle->scatter(dest.mHandle, indices.mHandle, entryBytes, entries);
+  }
+
   void memcpy(memory &dest,
               const void *source,
               const uintptr_t bytes,
@@ -282,6 +1539,8 @@ namespace occa {
 
   void device::setup(occa::mode m,
                      const int arg1, const int arg2){
+    loadEnvironmentBundles();
+
     mode_   = m;
     strMode = modeToStr(m);
 
@@ -326,7 +1585,11 @@ namespace occa {
       throw 1;
     }
 
-    dHandle->dev = this;
+    dHandle->dev   = this;
+    dHandle->graph = NULL;
+    dHandle->cacheId      = newDeviceCacheId();
+    dHandle->setupArgs[0] = arg1;
+    dHandle->setupArgs[1] = arg2;
     dHandle->setup(arg1, arg2);
 
     currentStream = genStream();
@@ -370,6 +1633,9 @@ namespace occa {
   }
 
   void device::finish(){
+    if(graph_v::captureFinish(this))
+      return;
+
     dHandle->finish();
   }
 
@@ -398,6 +1664,10 @@ namespace occa {
     return dHandle->memoryAllocated;
   }
 
+  uintptr_t device::hostMemoryAllocated(){
+    return dHandle->hostMemoryAllocated;
+  }
+
   void device::free(stream s){
     dHandle->freeStream(s);
   }
@@ -410,8 +1680,161 @@ namespace occa {
     ker.mode_   = mode_;
     ker.strMode = strMode;
 
-    ker.kHandle      = dHandle->buildKernelFromSource(filename, functionName, info_);
-    ker.kHandle->dev = this;
+    // Builds use the winner of an earlier autotuneKernel run
+    tuningRecord tuning;
+    kernelInfo info = info_;
+
+    const bool tuned = findTuningRecord(filename, functionName, info_, tuning);
+
+    if(tuned)
+      tuning.apply(info);
+
+    // Variants get their own profiles, they are attached with [info]
+    kernelInfo buildInfo = info;
+    kernelProfile *profile = kernelProfile::start(dHandle, mode_, filename, functionName, buildInfo);
+
+    // Instrumented builds are swapped out later, they are not shared
+    std::string key = ((profile == NULL)
+                       ? cachedKernelKey(filename, functionName, buildInfo)
+                       : "");
+
+    kernel_v *cached = findCachedKernel(key);
+
+    if(cached != NULL){
+      ker.kHandle = cloneKernelHandle(cached);
+    }
+    else{
+      try {
+        ker.kHandle = dHandle->buildKernelFromSource(filename, functionName, buildInfo);
+      }
+      catch(...){
+        delete profile;
+        profile = NULL;
+
+        // Compilers that reject -dumpdir or -fprofile-update=prefer-atomic (GCC
+        //   before 11, clang) or lack libgcov's __gcov_dump build it plainly
+        if(buildInfo.flags == info.flags)
+          throw;
+
+        std::cout << "Profiled build of [" << functionName << "] failed, "
+                  << "building it without profiling\n";
+
+        ker.kHandle = dHandle->buildKernelFromSource(filename, functionName, info);
+        key = "";
+      }
+
+      ker.kHandle->dev     = this;
+      ker.kHandle->profile = profile;
+
+      if(key.size())
+        addCachedKernel(key, ker.kHandle->data, cloneKernelHandle(ker.kHandle));
+    }
+
+    if(tuned){
+      ker.kHandle->tunedDims  = tuning.dims;
+      ker.kHandle->tunedInner = tuning.inner;
+    }
+
+    kernelVariants::attach(ker.kHandle, filename, functionName, info);
+
+    ker.kHandle->capture = kernelCapture::start(filename, functionName, info,
+                                                dHandle->compilerFlags);
+
+    return ker;
+  }
+
+  std::map<std::string, kernel> device::buildKernelsFromSource(const std::string &filename,
+                                                               const kernelInfo &info_){
+    std::vector<std::string> names;
+    getKernelNames(readFile(filename), names);
+
+    std::map<std::string, kernel> kernels;
+
+    // The binary is not keyed by function name, only the first kernel is compiled
+    const int kernelCount = names.size();
+
+    for(int i = 0; i < kernelCount; ++i){
+      if(kernels.find(names[i]) == kernels.end())
+        kernels[names[i]] = buildKernelFromSource(filename, names[i], info_);
+    }
+
+    return kernels;
+  }
+
+  kernel device::buildKernelFromSourceAsync(const std::string &filename,
+                                            const std::string &functionName,
+                                            const kernelInfo &info_){
+    return deferKernelBuild(filename, functionName, info_, false);
+  }
+
+  kernel device::buildKernelFromSourceLazy(const std::string &filename,
+                                           const std::string &functionName,
+                                           const kernelInfo &info_){
+    return deferKernelBuild(filename, functionName, info_, true);
+  }
+
+  kernel device::deferKernelBuild(const std::string &filename,
+                                  const std::string &functionName,
+                                  const kernelInfo &info_,
+                                  const bool lazy){
+    kernel ker;
+
+    ker.mode_   = mode_;
+    ker.strMode = strMode;
+
+    tuningRecord tuning;
+    kernelInfo info = info_;
+
+    const bool tuned = findTuningRecord(filename, functionName, info_, tuning);
+
+    if(tuned)
+      tuning.apply(info);
+
+    kernelInfo buildInfo = info;
+    kernelProfile *profile = kernelProfile::start(dHandle, mode_, filename, functionName, buildInfo);
+
+    const std::string key = ((profile == NULL)
+                             ? cachedKernelKey(filename, functionName, buildInfo)
+                             : "");
+
+    kernel_v *cached = findCachedKernel(key);
+
+    if(cached != NULL){
+      ker.kHandle = cloneKernelHandle(cached);
+    }
+    else{
+      kernelBuild *b = new kernelBuild;
+
+      b->kHandle      = newKernelHandle(mode_);
+      b->dHandle      = dHandle;
+      b->filename     = filename;
+      b->functionName = functionName;
+      b->cacheKey     = key;
+      b->info         = buildInfo;
+      b->plainInfo    = info;
+      b->state        = (lazy ? buildLazy : buildQueued);
+      b->failed       = false;
+
+      b->kHandle->dev          = this;
+      b->kHandle->functionName = functionName;
+      b->kHandle->build        = b;
+      b->kHandle->profile      = profile;
+
+      ker.kHandle = b->kHandle;
+
+      if(!lazy)
+        queueKernelBuild(b);
+    }
+
+    if(tuned){
+      ker.kHandle->tunedDims  = tuning.dims;
+      ker.kHandle->tunedInner = tuning.inner;
+    }
+
+    kernelVariants::attach(ker.kHandle, filename, functionName, info);
+
+    ker.kHandle->capture = kernelCapture::start(filename, functionName, info,
+                                                dHandle->compilerFlags);
 
     return ker;
   }
@@ -440,7 +1863,7 @@ namespace occa {
                                       const std::string &functionName,
                                       const std::string &pythonCode,
                                       const int useLoopyOrFloopy){
-    std::string cachedBinary = getCachedName(filename, pythonCode);
+    std::string cachedBinary = getCachedName(filename, pythonCode, "loo.py");
 
     struct stat buffer;
     bool fileExists = (stat(cachedBinary.c_str(), &buffer) == 0);
@@ -502,7 +1925,58 @@ namespace occa {
     return mem;
   }
 
+  void* device::mallocHost(const uintptr_t bytes){
+    pinnedBuffer buffer = dHandle->mallocHost(bytes);
+
+    dHandle->pinnedBuffers[(char*) buffer.ptr] = buffer;
+    dHandle->hostMemoryAllocated += bytes;
+
+    return buffer.ptr;
+  }
+
+  void device::freeHost(void *ptr){
+    std::map<char*, pinnedBuffer>::iterator it = dHandle->pinnedBuffers.find((char*) ptr);
+
+    if(it == dHandle->pinnedBuffers.end()){
+      std::cout << "Pointer [" << ptr << "] was not allocated with device::mallocHost.\n";
+      throw 1;
+    }
+
+    dHandle->hostMemoryAllocated -= it->second.bytes;
+    dHandle->freeHost(it->second);
+
+    dHandle->pinnedBuffers.erase(it);
+  }
+
+  memory device::mapFile(const std::string &filename,
+                         const uintptr_t offset,
+                         const uintptr_t bytes,
+                         const int flags){
+    memory mem;
+
+    mem.mode_   = mode_;
+    mem.strMode = strMode;
+
+    mem.mHandle      = dHandle->mapFile(filename, offset, bytes, flags);
+    mem.mHandle->dev = this;
+
+    dHandle->memoryAllocated += mem.mHandle->size;
+
+    return mem;
+  }
+
   void device::free(){
+    // Buffers from mallocHost that were never passed to freeHost
+    std::map<char*, pinnedBuffer>::iterator it = dHandle->pinnedBuffers.begin();
+
+    while(it != dHandle->pinnedBuffers.end()){
+      dHandle->freeHost(it->second);
+      ++it;
+    }
+
+    dHandle->pinnedBuffers.clear();
+    dHandle->hostMemoryAllocated = 0;
+
     const int streamCount = streams.size();
 
     for(int i = 0; i < streamCount; ++i)
@@ -0,0 +1,381 @@
+#include "occaBundle.hpp"
+#include "occaTools.hpp"
+#include "occaBase.hpp"
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+#  include <sys/mman.h>
+#  include <pthread.h>
+#endif
+
+namespace occa {
+  //---[ Kernel Bundles ]-------------
+  static const char bundleMagic[8] = {'O', 'C', 'C', 'A', 'B', 'N', 'D', 'L'};
+
+  class bundleEntry {
+  public:
+    const char *ptr;
+    uint64_t bytes;
+  };
+
+  static std::map<std::string, bundleEntry> bundledBinaries;
+  static std::vector<bundleWriter*> bundleWriters;
+
+  static std::string getBinaryName(const std::string &cachedBinary){
+    std::string prefix, name;
+    getFilePrefixAndName(cachedBinary, prefix, name);
+
+    return name;
+  }
+
+  bundleWriter::bundleWriter(){
+    bundleWriters.push_back(this);
+  }
+
+  bundleWriter::~bundleWriter(){
+    const int writers = bundleWriters.size();
+
+    for(int i = 0; i < writers; ++i){
+      if(bundleWriters[i] == this){
+        bundleWriters.erase(bundleWriters.begin() + i);
+        break;
+      }
+    }
+  }
+
+  void bundleWriter::add(const std::string &cachedBinary){
+    const int binaryCount = binaries.size();
+
+    for(int i = 0; i < binaryCount; ++i){
+      if(binaries[i] == cachedBinary)
+        return;
+    }
+
+    binaries.push_back(cachedBinary);
+  }
+
+  int bundleWriter::write(const std::string &filename){
+    std::vector<std::string> names, contents;
+
+    const int binaryCount = binaries.size();
+
+    for(int i = 0; i < binaryCount; ++i){
+      const std::string name = getBinaryName(binaries[i]);
+
+      // Loaded from another bundle, never written to the cache
+      std::map<std::string, bundleEntry>::iterator it = bundledBinaries.find(name);
+
+      if(it != bundledBinaries.end()){
+        names.push_back(name);
+        contents.push_back(std::string(it->second.ptr, it->second.bytes));
+        continue;
+      }
+
+      struct stat buffer;
+
+      // Names are recorded before building, skip builds that failed
+      if(stat(binaries[i].c_str(), &buffer) != 0)
+        continue;
+
+      names.push_back(name);
+      contents.push_back(readFile(binaries[i]));
+    }
+
+    const uint32_t entries = names.size();
+
+    uint64_t offset = sizeof(bundleMagic) + 2*sizeof(uint32_t);
+
+    for(uint32_t i = 0; i < entries; ++i)
+      offset += sizeof(uint32_t) + names[i].size() + 2*sizeof(uint64_t);
+
+    std::ofstream fs(filename.c_str(), std::ios::out | std::ios::binary);
+
+    if(!fs){
+      std::cout << "Could not write bundle [" << filename << "]\n";
+      throw 1;
+    }
+
+    fs.write(bundleMagic, sizeof(bundleMagic));
+    fs.write((const char*) &bundleVersion, sizeof(uint32_t));
+    fs.write((const char*) &entries, sizeof(uint32_t));
+
+    for(uint32_t i = 0; i < entries; ++i){
+      const uint32_t nameBytes = names[i].size();
+      const uint64_t bytes     = contents[i].size();
+
+      fs.write((const char*) &nameBytes, sizeof(uint32_t));
+      fs.write(names[i].c_str(), nameBytes);
+      fs.write((const char*) &offset, sizeof(uint64_t));
+      fs.write((const char*) &bytes, sizeof(uint64_t));
+
+      offset += bytes;
+    }
+
+    for(uint32_t i = 0; i < entries; ++i)
+      fs.write(contents[i].c_str(), contents[i].size());
+
+    const bool written = fs.good();
+
+    fs.close();
+
+    if(!written || !fs.good()){
+      remove(filename.c_str());
+
+      std::cout << "Could not write bundle [" << filename << "]\n";
+      throw 1;
+    }
+
+    return entries;
+  }
+
+  int loadBundle(const std::string &filename){
+    uintptr_t bytes = 0;
+    void *mappedPtr;
+    uintptr_t mappedBytes;
+
+    const char *bundle = (const char*) mapFile(filename, 0, bytes,
+                                               mapReadOnly | mapRandom,
+                                               mappedPtr, mappedBytes);
+
+    const uint64_t headerBytes = sizeof(bundleMagic) + 2*sizeof(uint32_t);
+
+    uint32_t version = 0, entries = 0;
+
+    if(headerBytes <= bytes){
+      ::memcpy(&version, bundle + sizeof(bundleMagic), sizeof(uint32_t));
+      ::memcpy(&entries, bundle + sizeof(bundleMagic) + sizeof(uint32_t), sizeof(uint32_t));
+    }
+
+    if((bytes < headerBytes) ||
+       ::memcmp(bundle, bundleMagic, sizeof(bundleMagic)) ||
+       (version != bundleVersion)){
+      unmapFile(mappedPtr, mappedBytes);
+
+      std::cout << "File [" << filename << "] is not a version "
+                << bundleVersion << " OCCA bundle\n";
+      throw 1;
+    }
+
+    const char *c   = bundle + headerBytes;
+    const char *end = bundle + bytes;
+
+    for(uint32_t i = 0; i < entries; ++i){
+      uint32_t nameBytes = 0;
+      uint64_t offset    = 0;
+      bundleEntry entry;
+
+      bool valid = ((c + sizeof(uint32_t)) <= end);
+
+      if(valid){
+        ::memcpy(&nameBytes, c, sizeof(uint32_t));
+        c += sizeof(uint32_t);
+
+        valid = ((uint64_t) (end - c) >= (nameBytes + 2*sizeof(uint64_t)));
+      }
+
+      if(valid){
+        ::memcpy(&offset, c + nameBytes, sizeof(uint64_t));
+        ::memcpy(&(entry.bytes), c + nameBytes + sizeof(uint64_t), sizeof(uint64_t));
+
+        valid = ((offset <= bytes) && (entry.bytes <= (bytes - offset)));
+      }
+
+      if(!valid){
+        std::cout << "Bundle [" << filename << "] is truncated\n";
+        throw 1;
+      }
+
+      const std::string name(c, nameBytes);
+      c += nameBytes + 2*sizeof(uint64_t);
+
+      entry.ptr = bundle + offset;
+
+      bundledBinaries[name] = entry;
+    }
+
+    return entries;
+  }
+
+  void loadEnvironmentBundles(){
+    static bool loaded = false;
+
+    if(loaded)
+      return;
+
+    loaded = true;
+
+    char *c_bundles = getenv("OCCA_BUNDLE");
+
+    if(c_bundles == NULL)
+      return;
+
+    std::stringstream ss(c_bundles);
+    std::string bundle;
+
+    while(std::getline(ss, bundle, ':')){
+      if(bundle.size())
+        loadBundle(bundle);
+    }
+  }
+
+  void recordCachedBinary(const std::string &cachedBinary){
+    const int writers = bundleWriters.size();
+
+    for(int i = 0; i < writers; ++i)
+      bundleWriters[i]->add(cachedBinary);
+  }
+
+  // Bundled binaries copied out for loading, by cache name
+  static std::map<std::string, std::string> loadableBinaries;
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+  static pthread_mutex_t loadableMutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+  static std::string bundleTmpDir;
+
+  static void removeBundleTmpDir(){
+    std::map<std::string, std::string>::iterator it = loadableBinaries.begin();
+
+    for(; it != loadableBinaries.end(); ++it){
+#if OCCA_OS == WINDOWS_OS
+      remove((it->second + ".dll").c_str());
+#else
+      remove(it->second.c_str());
+#endif
+    }
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    rmdir(bundleTmpDir.c_str());
+#else
+    RemoveDirectoryA(bundleTmpDir.c_str());
+#endif
+  }
+
+  static std::string writeTmpBinary(const std::string &name,
+                                    const bundleEntry &entry){
+    if(bundleTmpDir.size() == 0){
+      char *c_tmp = getenv("TMPDIR");
+      std::string tmp = ((c_tmp != NULL) ? std::string(c_tmp) : std::string("/tmp"));
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+      std::string dirTemplate = tmp + "/occa_bundle_XXXXXX";
+
+      if(mkdtemp(&(dirTemplate[0])) == NULL)
+        return "";
+
+      bundleTmpDir = dirTemplate;
+#else
+      char c_winTmp[MAX_PATH];
+
+      if(GetTempPathA(MAX_PATH, c_winTmp) == 0)
+        return "";
+
+      std::stringstream dir;
+      dir << c_winTmp << "occa_bundle_" << GetCurrentProcessId();
+
+      if(CreateDirectoryA(dir.str().c_str(), NULL) == FALSE)
+        return "";
+
+      bundleTmpDir = dir.str();
+#endif
+
+      atexit(removeBundleTmpDir);
+    }
+
+    const std::string path = bundleTmpDir + "/" + name;
+
+#if OCCA_OS == WINDOWS_OS
+    // Windows refuses to load dll's that do not end with '.dll'
+    std::ofstream fs((path + ".dll").c_str(), std::ios::out | std::ios::binary);
+#else
+    std::ofstream fs(path.c_str(), std::ios::out | std::ios::binary);
+#endif
+
+    fs.write(entry.ptr, entry.bytes);
+    fs.close();
+
+    if(!fs.good())
+      return "";
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    chmod(path.c_str(), 0500);
+#endif
+
+    return path;
+  }
+
+#if (OCCA_OS == LINUX_OS) && defined(MFD_CLOEXEC)
+  // The memfd stays open for the rest of the run
+  static std::string writeMemBinary(const std::string &name,
+                                    const bundleEntry &entry){
+    const int fd = memfd_create(name.c_str(), MFD_CLOEXEC);
+
+    if(fd < 0)
+      return "";
+
+    const char *c = entry.ptr;
+    uint64_t left = entry.bytes;
+
+    while(left){
+      const ssize_t written = ::write(fd, c, left);
+
+      if(written <= 0){
+        if((written < 0) && (errno == EINTR))
+          continue;
+
+        close(fd);
+        return "";
+      }
+
+      c    += written;
+      left -= written;
+    }
+
+    std::stringstream path;
+    path << "/proc/self/fd/" << fd;
+
+    return path.str();
+  }
+#endif
+
+  std::string getBundledBinary(const std::string &cachedBinary){
+    if(bundledBinaries.size() == 0)
+      return "";
+
+    const std::string name = getBinaryName(cachedBinary);
+
+    std::map<std::string, bundleEntry>::iterator it = bundledBinaries.find(name);
+
+    if(it == bundledBinaries.end())
+      return "";
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    pthread_mutex_lock(&loadableMutex);
+#endif
+
+    std::string path;
+    std::map<std::string, std::string>::iterator lIt = loadableBinaries.find(name);
+
+    if(lIt != loadableBinaries.end()){
+      path = lIt->second;
+    }
+    else{
+#if (OCCA_OS == LINUX_OS) && defined(MFD_CLOEXEC)
+      path = writeMemBinary(name, it->second);
+#endif
+
+      if(path.size() == 0)
+        path = writeTmpBinary(name, it->second);
+
+      if(path.size())
+        loadableBinaries[name] = path;
+    }
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    pthread_mutex_unlock(&loadableMutex);
+#endif
+
+    return path;
+  }
+  //==================================
+}
@@ -1,6 +1,7 @@
 #if OCCA_COI_ENABLED
 
 #include "occaCOI.hpp"
+#include "occaGraph.hpp"
 
 namespace occa {
   //---[ Kernel ]---------------------
@@ -60,6 +61,48 @@ namespace occa {
   template <>
   kernel_t<COI>::~kernel_t(){}
 
+  //---[ Library Cache ]--------------
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+  static pthread_mutex_t libraryMutex = PTHREAD_MUTEX_INITIALIZER;
+
+  static inline void lockLibraries(){
+    pthread_mutex_lock(&libraryMutex);
+  }
+
+  static inline void unlockLibraries(){
+    pthread_mutex_unlock(&libraryMutex);
+  }
+#else
+  static inline void lockLibraries(){}
+  static inline void unlockLibraries(){}
+#endif
+
+  static bool isLibraryLoaded(COIDeviceData_t &dData,
+                              const std::string &binary){
+    lockLibraries();
+
+    const bool loaded = (dData.libraries.find(binary) != dData.libraries.end());
+
+    unlockLibraries();
+
+    return loaded;
+  }
+
+  // If another thread loaded [binary] first, the new copy is unloaded
+  static void keepLibrary(COIDeviceData_t &dData,
+                          const std::string &binary,
+                          COILIBRARY library){
+    lockLibraries();
+
+    if(dData.libraries.find(binary) == dData.libraries.end())
+      dData.libraries[binary] = library;
+    else
+      COIProcessUnloadLibrary(dData.chiefID, library);
+
+    unlockLibraries();
+  }
+  //==================================
+
   template <>
   kernel_t<COI>* kernel_t<COI>::buildFromSource(const std::string &filename,
                                                           const std::string &functionName_,
@@ -77,10 +120,10 @@ namespace occa {
          << info.salt()
          << dev->dHandle->compilerEnvScript
          << dev->dHandle->compiler
-         << dev->dHandle->compilerFlags
-         << functionName;
+         << dev->dHandle->compilerFlags;
 
-    std::string cachedBinary = getCachedName(filename, salt.str());
+    std::string cachedBinary = getCachedName(filename, salt.str(), "COI",
+                                             dev->dHandle->compilerFlags + ' ' + info.flags);
     std::string libPath, soname;
 
     getFilePrefixAndName(cachedBinary, libPath, soname);
@@ -89,19 +132,19 @@ namespace occa {
 
     cachedBinary = libPath + libName;
 
+    COIDeviceData_t &dData = *((COIDeviceData_t*) dev->dHandle->data);
+
     struct stat buffer;
     bool fileExists = (stat(cachedBinary.c_str(), &buffer) == 0);
 
-    if(fileExists){
+    if(fileExists || isLibraryLoaded(dData, cachedBinary)){
       std::cout << "Found cached binary of [" << filename << "] in [" << cachedBinary << "]\n";
       return buildFromBinary(cachedBinary, functionName);
     }
 
-    if(!haveFile(cachedBinary)){
-      waitForFile(cachedBinary);
-
+    // Someone else is making it (or failed to, then it's ours to make)
+    if(!haveFile(cachedBinary) && waitForFile(cachedBinary))
       return buildFromBinary(cachedBinary, functionName);
-    }
 
     std::string iCachedBinary = createIntermediateSource(filename,
                                                          cachedBinary,
@@ -134,41 +177,12 @@ namespace occa {
 
     const int compileError = system(sCommand.c_str());
 
-    if(compileError){
-      releaseFile(cachedBinary);
-      throw 1;
-    }
-
-    OCCA_EXTRACT_DATA(COI, Kernel);
-
-    COILIBRARY outLibrary;
-
-    const COIRESULT loadingLibraryResult = COIProcessLoadLibraryFromFile(data_.chiefID,
-                                                                         cachedBinary.c_str(),
-                                                                         soname.c_str(),
-                                                                         NULL,
-                                                                         &outLibrary);
-
-    if(errorCode != COI_SUCCESS)
-      releaseFile(cachedBinary);
-
-    OCCA_COI_CHECK("Kernel: Loading Kernel To Chief", loadingLibraryResult);
-
-    const char *c_functionName = functionName.c_str();
-
-    const COIRESULT getFunctionHandleResult = COIProcessGetFunctionHandles(data_.chiefID,
-                                                                           1,
-                                                                           &c_functionName,
-                                                                           &(data_.kernel));
-
-    if(errorCode != COI_SUCCESS)
-      releaseFile(cachedBinary);
-
-    OCCA_COI_CHECK("Kernel: Getting Handle", getFunctionHandleResult);
-
     releaseFile(cachedBinary);
 
-    return this;
+    if(compileError)
+      throw 1;
+
+    return buildFromBinary(cachedBinary, functionName);
   }
 
   template <>
@@ -190,14 +204,21 @@ namespace occa {
       }
     }
 
-    COILIBRARY outLibrary;
+    COIDeviceData_t &dData = *((COIDeviceData_t*) dev->dHandle->data);
+
+    // Another kernel of the binary already loaded it into the chief
+    if(!isLibraryLoaded(dData, filename)){
+      COILIBRARY outLibrary;
 
-    OCCA_COI_CHECK("Kernel: Loading Kernel To Chief",
-                   COIProcessLoadLibraryFromFile(data_.chiefID,
-                                                 filename.c_str(),
-                                                 soname.c_str(),
-                                                 NULL,
-                                                 &outLibrary));
+      OCCA_COI_CHECK("Kernel: Loading Kernel To Chief",
+                     COIProcessLoadLibraryFromFile(data_.chiefID,
+                                                   filename.c_str(),
+                                                   soname.c_str(),
+                                                   NULL,
+                                                   &outLibrary));
+
+      keepLibrary(dData, filename, outLibrary);
+    }
 
     const char *c_functionName = functionName.c_str();
 
@@ -228,6 +249,11 @@ namespace occa {
     return 1.0e3*(end - start);
   }
 
+  template <>
+  bool kernel_t<COI>::dumpProfile(){
+    return false;
+  }
+
   template <>
   void kernel_t<COI>::free(){
   }
@@ -481,6 +507,40 @@ namespace occa {
                                  &(stream.lastEvent)));
   }
 
+  template <>
+  void memory_t<COI>::fill(const void *pattern,
+                           const uintptr_t patternBytes,
+                           const uintptr_t bytes,
+                           const uintptr_t offset){
+    const uintptr_t bytes_ = (bytes == 0) ? size : bytes;
+
+    OCCA_CHECK((bytes_ + offset) <= size);
+
+    char *buffer = new char[bytes_];
+
+    occa::memFill(buffer, pattern, patternBytes, bytes_);
+
+    copyFrom(buffer, bytes_, offset);
+
+    delete [] buffer;
+  }
+
+  template <>
+  void memory_t<COI>::gather(memory_v *dest,
+                             const memory_v *indices,
+                             const uintptr_t entryBytes,
+                             const uintptr_t entries){
+    hostGather(dest, indices, entryBytes, entries);
+  }
+
+  template <>
+  void memory_t<COI>::scatter(memory_v *dest,
+                              const memory_v *indices,
+                              const uintptr_t entryBytes,
+                              const uintptr_t entries){
+    hostScatter(dest, indices, entryBytes, entries);
+  }
+
   template <>
   void memory_t<COI>::free(){
     OCCA_COI_CHECK("Memory: free",
@@ -496,32 +556,38 @@ namespace occa {
   //---[ Device ]---------------------
   template <>
   device_t<COI>::device_t(){
-    data            = NULL;
-    memoryAllocated = 0;
+    data                = NULL;
+    memoryAllocated     = 0;
+    hostMemoryAllocated = 0;
 
     getEnvironmentVariables();
   }
 
   template <>
   device_t<COI>::device_t(int platform, int device){
-    data            = NULL;
-    memoryAllocated = 0;
+    data                = NULL;
+    memoryAllocated     = 0;
+    hostMemoryAllocated = 0;
 
     getEnvironmentVariables();
   }
 
   template <>
   device_t<COI>::device_t(const device_t<COI> &d){
-    data            = d.data;
-    memoryAllocated = d.memoryAllocated;
+    data                = d.data;
+    memoryAllocated     = d.memoryAllocated;
+    hostMemoryAllocated = d.hostMemoryAllocated;
+    pinnedBuffers       = d.pinnedBuffers;
 
     compilerFlags = d.compilerFlags;
   }
 
   template <>
   device_t<COI>& device_t<COI>::operator = (const device_t<COI> &d){
-    data            = d.data;
-    memoryAllocated = d.memoryAllocated;
+    data                = d.data;
+    memoryAllocated     = d.memoryAllocated;
+    hostMemoryAllocated = d.hostMemoryAllocated;
+    pinnedBuffers       = d.pinnedBuffers;
 
     compilerFlags = d.compilerFlags;
 
@@ -547,7 +613,7 @@ namespace occa {
     salt << "COI"
          << occaCOIMain;
 
-    std::string cachedBinary = getCachedName("occaCOIMain", salt.str());
+    std::string cachedBinary = getCachedName("occaCOIMain", salt.str(), "COI");
 
     struct stat buffer;
     bool fileExists = (stat(cachedBinary.c_str(), &buffer) == 0);
@@ -562,7 +628,7 @@ namespace occa {
 
       const std::string iCachedBinary = prefix + "i_" + name;
 
-      if(haveFile(cachedBinary)){
+      if(haveFile(cachedBinary) || !waitForFile(cachedBinary)){
         std::cout << "Making [" << iCachedBinary << "]\n";
 
         std::ofstream fs;
@@ -588,8 +654,6 @@ namespace occa {
 
         releaseFile(cachedBinary);
       }
-      else
-        waitForFile(cachedBinary);
     }
 
     // [-] Tentative
@@ -792,6 +856,41 @@ namespace occa {
     return mem;
   }
 
+  template <>
+  memory_v* device_t<COI>::mapFile(const std::string &filename,
+                                   const uintptr_t offset,
+                                   const uintptr_t bytes,
+                                   const int flags){
+    // Stage through a read-only host mapping, skipping the intermediate read
+    uintptr_t bytes_ = bytes;
+    void *mappedPtr;
+    uintptr_t mappedBytes;
+
+    void *source = occa::mapFile(filename, offset, bytes_, occa::mapReadOnly | occa::mapSequential,
+                                 mappedPtr, mappedBytes);
+
+    memory_v *mem = malloc(bytes_, source);
+
+    occa::unmapFile(mappedPtr, mappedBytes);
+
+    return mem;
+  }
+
+  template <>
+  pinnedBuffer device_t<COI>::mallocHost(const uintptr_t bytes){
+    pinnedBuffer buffer;
+
+    buffer.ptr   = occa::pinnedAlloc(bytes);
+    buffer.bytes = bytes;
+
+    return buffer;
+  }
+
+  template <>
+  void device_t<COI>::freeHost(pinnedBuffer &buffer){
+    occa::pinnedFree(buffer.ptr, buffer.bytes);
+  }
+
   template <>
   void device_t<COI>::free(){
     OCCA_EXTRACT_DATA(COI, Device);
@@ -803,7 +902,7 @@ namespace occa {
                                      NULL,
                                      NULL));
 
-    delete data;
+    delete (COIDeviceData_t*) data;
   }
 
   template <>
@@ -812,6 +911,11 @@ namespace occa {
 
     return 16;
   }
+
+  template <>
+  void device_t<COI>::runGraph(graph_v &graph){
+    graph.runNodes();
+  }
   //==================================
 
 
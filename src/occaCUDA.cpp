@@ -1,6 +1,7 @@
 #if OCCA_CUDA_ENABLED
 
 #include "occaCUDA.hpp"
+#include "occaGraph.hpp"
 
 namespace occa {
   //---[ Kernel ]---------------------
@@ -58,6 +59,61 @@ namespace occa {
   template <>
   kernel_t<CUDA>::~kernel_t(){}
 
+  //---[ Module Cache ]---------------
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+  static pthread_mutex_t moduleMutex = PTHREAD_MUTEX_INITIALIZER;
+
+  static inline void lockModules(){
+    pthread_mutex_lock(&moduleMutex);
+  }
+
+  static inline void unlockModules(){
+    pthread_mutex_unlock(&moduleMutex);
+  }
+#else
+  static inline void lockModules(){}
+  static inline void unlockModules(){}
+#endif
+
+  static bool findModule(CUDADeviceData_t &dData,
+                         const std::string &binary,
+                         CUmodule &module){
+    lockModules();
+
+    std::map<std::string, CUmodule>::iterator it = dData.modules.find(binary);
+
+    const bool found = (it != dData.modules.end());
+
+    if(found)
+      module = it->second;
+
+    unlockModules();
+
+    return found;
+  }
+
+  // If another thread loaded [binary] first, its module is used instead
+  static CUmodule keepModule(CUDADeviceData_t &dData,
+                             const std::string &binary,
+                             CUmodule module){
+    lockModules();
+
+    std::map<std::string, CUmodule>::iterator it = dData.modules.find(binary);
+
+    if(it == dData.modules.end()){
+      dData.modules[binary] = module;
+    }
+    else{
+      cuModuleUnload(module);
+      module = it->second;
+    }
+
+    unlockModules();
+
+    return module;
+  }
+  //==================================
+
   template <>
   kernel_t<CUDA>* kernel_t<CUDA>::buildFromSource(const std::string &filename,
                                                   const std::string &functionName_,
@@ -77,24 +133,24 @@ namespace occa {
          << info.salt()
          << dev->dHandle->compilerEnvScript
          << dev->dHandle->compiler
-         << dev->dHandle->compilerFlags
-         << functionName;
+         << dev->dHandle->compilerFlags;
+
+    std::string cachedBinary = getCachedName(filename, salt.str(), "CUDA",
+                                             dev->dHandle->compilerFlags + ' ' + info.flags);
 
-    std::string cachedBinary = getCachedName(filename, salt.str());
+    CUDADeviceData_t &dData = *((CUDADeviceData_t*) dev->dHandle->data);
 
     struct stat buffer;
     const bool fileExists = (stat(cachedBinary.c_str(), &buffer) == 0);
 
-    if(fileExists){
+    if(fileExists || findModule(dData, cachedBinary, data_.module)){
       std::cout << "Found cached binary of [" << filename << "] in [" << cachedBinary << "]\n";
       return buildFromBinary(cachedBinary, functionName);
     }
 
-    if(!haveFile(cachedBinary)){
-      waitForFile(cachedBinary);
-
+    // Someone else is making it (or failed to, then it's ours to make)
+    if(!haveFile(cachedBinary) && waitForFile(cachedBinary))
       return buildFromBinary(cachedBinary, functionName);
-    }
 
     std::string iCachedBinary = createIntermediateSource(filename,
                                                          cachedBinary,
@@ -174,6 +230,8 @@ namespace occa {
     OCCA_CUDA_CHECK("Kernel (" + functionName + ") : Loading Module",
                     moduleLoadError);
 
+    data_.module = keepModule(dData, cachedBinary, data_.module);
+
     const CUresult moduleGetFunctionError = cuModuleGetFunction(&data_.function,
                                                                 data_.module,
                                                                 functionName.c_str());
@@ -196,8 +254,15 @@ namespace occa {
 
     functionName = functionName_;
 
-    OCCA_CUDA_CHECK("Kernel (" + functionName + ") : Loading Module",
-                    cuModuleLoad(&data_.module, filename.c_str()));
+    CUDADeviceData_t &dData = *((CUDADeviceData_t*) dev->dHandle->data);
+
+    // Another kernel of the binary already loaded its module
+    if(!findModule(dData, filename, data_.module)){
+      OCCA_CUDA_CHECK("Kernel (" + functionName + ") : Loading Module",
+                      cuModuleLoad(&data_.module, filename.c_str()));
+
+      data_.module = keepModule(dData, filename, data_.module);
+    }
 
     OCCA_CUDA_CHECK("Kernel (" + functionName + ") : Loading Function",
                     cuModuleGetFunction(&data_.function, data_.module, functionName.c_str()));
@@ -226,6 +291,11 @@ namespace occa {
     return 1.0e-3*msTimeTaken;
   }
 
+  template <>
+  bool kernel_t<CUDA>::dumpProfile(){
+    return false;
+  }
+
   template <>
   void kernel_t<CUDA>::free(){
   }
@@ -325,6 +395,7 @@ namespace occa {
 
     OCCA_CHECK((bytes_ + offset) <= size);
 
+    // device::mallocHost sources are DMA'd directly, pageable ones get staged by the driver
     OCCA_CUDA_CHECK("Memory: Asynchronous Copy From",
                     cuMemcpyHtoDAsync(*((CUdeviceptr*) handle) + offset, source, bytes_, stream) );
   }
@@ -357,6 +428,7 @@ namespace occa {
 
     OCCA_CHECK((bytes_ + offset) <= size);
 
+    // The driver DMAs into device::mallocHost destinations directly, other ones are staged
     OCCA_CUDA_CHECK("Memory: Asynchronous Copy To",
                     cuMemcpyDtoHAsync(dest, *((CUdeviceptr*) handle) + offset, bytes_, stream) );
   }
@@ -379,6 +451,72 @@ namespace occa {
                                       bytes_, stream) );
   }
 
+  template <>
+  void memory_t<CUDA>::fill(const void *pattern,
+                            const uintptr_t patternBytes,
+                            const uintptr_t bytes,
+                            const uintptr_t offset){
+    const CUstream &stream = *((CUstream*) dev->currentStream);
+
+    const uintptr_t bytes_ = (bytes == 0) ? size : bytes;
+
+    OCCA_CHECK((bytes_ + offset) <= size);
+
+    const CUdeviceptr ptr = *((CUdeviceptr*) handle) + offset;
+
+    // cuMemsetD* only repeats aligned 1, 2 and 4 byte patterns
+    if(patternBytes == 1){
+      OCCA_CUDA_CHECK("Memory: Fill",
+                      cuMemsetD8Async(ptr, *((unsigned char*) pattern), bytes_, stream) );
+      return;
+    }
+
+    if((patternBytes == 2) && ((ptr % 2) == 0) && ((bytes_ % 2) == 0)){
+      OCCA_CUDA_CHECK("Memory: Fill",
+                      cuMemsetD16Async(ptr, *((unsigned short*) pattern), bytes_ / 2, stream) );
+      return;
+    }
+
+    if((patternBytes == 4) && ((ptr % 4) == 0) && ((bytes_ % 4) == 0)){
+      OCCA_CUDA_CHECK("Memory: Fill",
+                      cuMemsetD32Async(ptr, *((unsigned int*) pattern), bytes_ / 4, stream) );
+      return;
+    }
+
+    char *buffer = new char[bytes_];
+
+    occa::memFill(buffer, pattern, patternBytes, bytes_);
+
+    // Queued on [stream] to stay ordered with earlier work, pageable
+    //   sources are staged before the call returns
+    OCCA_CUDA_CHECK("Memory: Fill",
+                    cuMemcpyHtoDAsync(ptr, buffer, bytes_, stream) );
+
+    delete [] buffer;
+  }
+
+  template <>
+  void memory_t<CUDA>::gather(memory_v *dest,
+                              const memory_v *indices,
+                              const uintptr_t entryBytes,
+                              const uintptr_t entries){
+    // [-] Host-staged until CUDA mode can build helper kernels at runtime
+    dev->finish();
+
+    hostGather(dest, indices, entryBytes, entries);
+  }
+
+  template <>
+  void memory_t<CUDA>::scatter(memory_v *dest,
+                               const memory_v *indices,
+                               const uintptr_t entryBytes,
+                               const uintptr_t entries){
+    // [-] Host-staged until CUDA mode can build helper kernels at runtime
+    dev->finish();
+
+    hostScatter(dest, indices, entryBytes, entries);
+  }
+
   template <>
   void memory_t<CUDA>::free(){
     cuMemFree(*((CUdeviceptr*) handle));
@@ -391,24 +529,28 @@ namespace occa {
   //---[ Device ]---------------------
   template <>
   device_t<CUDA>::device_t(){
-    data            = NULL;
-    memoryAllocated = 0;
+    data                = NULL;
+    memoryAllocated     = 0;
+    hostMemoryAllocated = 0;
 
     getEnvironmentVariables();
   }
 
   template <>
   device_t<CUDA>::device_t(int platform, int device){
-    data            = NULL;
-    memoryAllocated = 0;
+    data                = NULL;
+    memoryAllocated     = 0;
+    hostMemoryAllocated = 0;
 
     getEnvironmentVariables();
   }
 
   template <>
   device_t<CUDA>::device_t(const device_t<CUDA> &d){
-    data            = d.data;
-    memoryAllocated = d.memoryAllocated;
+    data                = d.data;
+    memoryAllocated     = d.memoryAllocated;
+    hostMemoryAllocated = d.hostMemoryAllocated;
+    pinnedBuffers       = d.pinnedBuffers;
 
     compiler      = d.compiler;
     compilerFlags = d.compilerFlags;
@@ -416,8 +558,10 @@ namespace occa {
 
   template <>
   device_t<CUDA>& device_t<CUDA>::operator = (const device_t<CUDA> &d){
-    data            = d.data;
-    memoryAllocated = d.memoryAllocated;
+    data                = d.data;
+    memoryAllocated     = d.memoryAllocated;
+    hostMemoryAllocated = d.hostMemoryAllocated;
+    pinnedBuffers       = d.pinnedBuffers;
 
     compiler      = d.compiler;
     compilerFlags = d.compilerFlags;
@@ -561,6 +705,10 @@ namespace occa {
     kData_.device  = data_.device;
     kData_.context = data_.context;
 
+    // Asynchronous builds run outside the thread that created the context
+    OCCA_CUDA_CHECK("Kernel (" + functionName + ") : Setting Context",
+                    cuCtxSetCurrent(data_.context));
+
     k->buildFromSource(filename, functionName, info_);
     return k;
   }
@@ -604,6 +752,44 @@ namespace occa {
     return mem;
   }
 
+  template <>
+  memory_v* device_t<CUDA>::mapFile(const std::string &filename,
+                                    const uintptr_t offset,
+                                    const uintptr_t bytes,
+                                    const int flags){
+    // Stage through a read-only host mapping, skipping the intermediate read
+    uintptr_t bytes_ = bytes;
+    void *mappedPtr;
+    uintptr_t mappedBytes;
+
+    void *source = occa::mapFile(filename, offset, bytes_, occa::mapReadOnly | occa::mapSequential,
+                                 mappedPtr, mappedBytes);
+
+    memory_v *mem = malloc(bytes_, source);
+
+    occa::unmapFile(mappedPtr, mappedBytes);
+
+    return mem;
+  }
+
+  template <>
+  pinnedBuffer device_t<CUDA>::mallocHost(const uintptr_t bytes){
+    pinnedBuffer buffer;
+
+    buffer.bytes = bytes;
+
+    OCCA_CUDA_CHECK("Device: mallocHost",
+                    cuMemHostAlloc(&(buffer.ptr), bytes, CU_MEMHOSTALLOC_PORTABLE) );
+
+    return buffer;
+  }
+
+  template <>
+  void device_t<CUDA>::freeHost(pinnedBuffer &buffer){
+    OCCA_CUDA_CHECK("Device: freeHost",
+                    cuMemFreeHost(buffer.ptr) );
+  }
+
   template <>
   void device_t<CUDA>::free(){
     OCCA_EXTRACT_DATA(CUDA, Device);
@@ -628,6 +814,11 @@ namespace occa {
 
     return simdWidth_;
   }
+
+  template <>
+  void device_t<CUDA>::runGraph(graph_v &graph){
+    graph.runNodes();
+  }
   //==================================
 
 
@@ -0,0 +1,366 @@
+#include "occaCache.hpp"
+#include "occaTools.hpp"
+#include "occaBase.hpp"
+
+#include <algorithm>
+#include <time.h>
+
+namespace occa {
+  //---[ Cache Index ]----------------
+  cacheEntry::cacheEntry() :
+    lastUse(0),
+    bytes(0) {}
+
+  std::string getCacheIndex(){
+    return getCachePath() + "index";
+  }
+
+  uint64_t parseByteSize(const std::string &str){
+    const char *c = str.c_str();
+    char *end;
+
+    const double value = strtod(c, &end);
+
+    if((end == c) || (value < 0))
+      return 0;
+
+    double scale = 1;
+
+    switch(*end){
+    case 'k': case 'K': scale = (1 << 10); ++end; break;
+    case 'm': case 'M': scale = (1 << 20); ++end; break;
+    case 'g': case 'G': scale = (1 << 30); ++end; break;
+    }
+
+    // Allow 512MB, 512MiB
+    if((*end == 'i') && (1 < scale))
+      ++end;
+    if(*end == 'B')
+      ++end;
+
+    if(*end != '\0')
+      return 0;
+
+    return (uint64_t) (scale * value);
+  }
+
+  uint64_t getCacheLimit(){
+    char *c_size = getenv("OCCA_CACHE_SIZE");
+
+    if(c_size == NULL)
+      return 0;
+
+    return parseByteSize(c_size);
+  }
+
+  // Returns "" for files that are not cached binaries
+  static std::string getEntryName(const std::string &cachedBinary){
+    const std::string cachePath = getCachePath();
+
+    if((cachedBinary.size() <= cachePath.size()) ||
+       (cachedBinary.compare(0, cachePath.size(), cachePath) != 0)){
+      return "";
+    }
+
+    std::string prefix, name;
+    getFilePrefixAndName(cachedBinary, prefix, name);
+
+    std::string entry = cachedBinary.substr(cachePath.size());
+
+    if(name.compare(0, strlen(cacheVersion) + 1, std::string(cacheVersion) + "_") != 0)
+      return "";
+
+    // OpenMP adds .dll on Windows
+    const size_t chars = entry.size();
+
+    if((4 < chars) && (entry.compare(chars - 4, 4, ".dll") == 0))
+      entry = entry.substr(0, chars - 4);
+
+    return entry;
+  }
+
+  void getCacheEntryFiles(const std::string &cachedBinary,
+                          std::vector<std::string> &files){
+    std::string prefix, name;
+    getFilePrefixAndName(cachedBinary, prefix, name);
+
+    files.push_back(cachedBinary);
+    files.push_back(cachedBinary + ".dll");
+    files.push_back(cachedBinary + ".deps");
+    files.push_back(prefix + "i_" + name);
+    files.push_back(prefix + "p_" + name);
+  }
+
+  uint64_t getCacheEntryBytes(const std::string &cachedBinary){
+    std::vector<std::string> files;
+    getCacheEntryFiles(cachedBinary, files);
+
+    uint64_t bytes = 0;
+
+    for(size_t i = 0; i < files.size(); ++i){
+      struct stat buffer;
+
+      if(stat(files[i].c_str(), &buffer) == 0)
+        bytes += buffer.st_size;
+    }
+
+    return bytes;
+  }
+
+  static const off_t indexCompactBytes = (1 << 20);
+
+  // Rewrites the index once it grew to twice its last compacted size (and past
+  //   indexCompactBytes), skipped if it is being pruned or compacted elsewhere
+  static void compactCacheIndex(){
+    const std::string index = getCacheIndex();
+    struct stat buffer;
+
+    if((stat(index.c_str(), &buffer) != 0) ||
+       (buffer.st_size < indexCompactBytes)){
+      return;
+    }
+
+    std::ifstream fs(index.c_str());
+
+    std::string tag;
+    off_t compactedBytes = 0;
+
+    if(!(fs >> tag >> compactedBytes) || (tag != "#compacted"))
+      compactedBytes = 0;
+
+    fs.close();
+
+    if(buffer.st_size < 2*compactedBytes)
+      return;
+
+    if(!haveFile(index))
+      return;
+
+    std::map<std::string, cacheEntry> entries;
+    readCacheIndex(entries);
+    writeCacheIndex(entries);
+
+    releaseFile(index);
+  }
+
+  static void appendIndexRecord(const cacheEntry &entry){
+    std::stringstream record;
+
+    record << entry.lastUse << ' '
+           << entry.bytes   << ' '
+           << (entry.mode.size() ? entry.mode : "-") << ' '
+           << entry.name    << ' '
+           << entry.source  << '\n';
+
+    // Appends below the pipe buffer size land as whole lines
+    std::ofstream fs(getCacheIndex().c_str(), std::ios::out | std::ios::app);
+    fs << record.str();
+    fs.close();
+
+    compactCacheIndex();
+  }
+
+  void touchCacheEntry(const std::string &cachedBinary,
+                       const std::string &mode,
+                       const std::string &source){
+    cacheEntry entry;
+
+    entry.name = getEntryName(cachedBinary);
+
+    if(entry.name.size() == 0)
+      return;
+
+    entry.mode    = mode;
+    entry.source  = (source.size() ? getCanonicalPath(source) : "");
+    entry.lastUse = (int64_t) time(NULL);
+    entry.bytes   = getCacheEntryBytes(getCachePath() + entry.name);
+
+    appendIndexRecord(entry);
+  }
+
+  void addCacheEntry(const std::string &cachedBinary){
+    struct stat buffer;
+
+    // The build failed
+    if(stat(cachedBinary.c_str(), &buffer) != 0)
+      return;
+
+    cacheEntry entry;
+
+    entry.name = getEntryName(cachedBinary);
+
+    if(entry.name.size() == 0)
+      return;
+
+    entry.lastUse = (int64_t) time(NULL);
+    entry.bytes   = getCacheEntryBytes(getCachePath() + entry.name);
+
+    appendIndexRecord(entry);
+
+    const uint64_t limit = getCacheLimit();
+
+    if(limit)
+      pruneCache(limit);
+  }
+
+  void readCacheIndex(std::map<std::string, cacheEntry> &entries){
+    const std::string cachePath = getCachePath();
+
+    std::ifstream fs(getCacheIndex().c_str());
+    std::string line;
+
+    while(std::getline(fs, line)){
+      std::stringstream ss(line);
+      cacheEntry record;
+
+      // A torn line from a crashed writer
+      if(!(ss >> record.lastUse >> record.bytes >> record.mode >> record.name))
+        continue;
+
+      std::getline(ss >> std::ws, record.source);
+
+      if(record.mode == "-")
+        record.mode = "";
+
+      cacheEntry &entry = entries[record.name];
+
+      entry.name    = record.name;
+      entry.lastUse = std::max(entry.lastUse, record.lastUse);
+
+      if(record.bytes)
+        entry.bytes = record.bytes;
+      if(record.mode.size())
+        entry.mode = record.mode;
+      if(record.source.size())
+        entry.source = record.source;
+    }
+
+    std::map<std::string, cacheEntry>::iterator it = entries.begin();
+
+    while(it != entries.end()){
+      struct stat buffer;
+      const std::string binary = cachePath + it->first;
+
+      if((stat(binary.c_str(), &buffer) != 0) &&
+         (stat((binary + ".dll").c_str(), &buffer) != 0)){
+        entries.erase(it++);
+        continue;
+      }
+
+      // Only seen through cache hits (bundled binaries)
+      if(it->second.bytes == 0)
+        it->second.bytes = getCacheEntryBytes(binary);
+
+      ++it;
+    }
+  }
+
+  void writeCacheIndex(const std::map<std::string, cacheEntry> &entries){
+    const std::string index = getCacheIndex();
+
+    std::stringstream tmpIndex;
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    tmpIndex << index << ".tmp." << getpid();
+#else
+    tmpIndex << index << ".tmp." << GetCurrentProcessId();
+#endif
+
+    std::stringstream records;
+
+    std::map<std::string, cacheEntry>::const_iterator it = entries.begin();
+
+    while(it != entries.end()){
+      const cacheEntry &entry = it->second;
+
+      records << entry.lastUse << ' '
+              << entry.bytes   << ' '
+              << (entry.mode.size() ? entry.mode : "-") << ' '
+              << entry.name    << ' '
+              << entry.source  << '\n';
+
+      ++it;
+    }
+
+    // Skipped by readCacheIndex, tells compactCacheIndex when to compact again
+    std::ofstream fs(tmpIndex.str().c_str());
+
+    fs << "#compacted " << records.str().size() << '\n'
+       << records.str();
+
+    fs.close();
+
+    // Records appended while compacting are lost, they only refresh last uses
+    rename(tmpIndex.str().c_str(), index.c_str());
+  }
+
+  static bool usedBefore(const cacheEntry *a, const cacheEntry *b){
+    return (a->lastUse < b->lastUse);
+  }
+
+  // Entries used this recently may be about to be loaded, they are not evicted
+  static const int64_t pruneGraceSeconds = 60;
+
+  uint64_t pruneCache(const uint64_t maxBytes){
+    const std::string cachePath = getCachePath();
+    const std::string index     = getCacheIndex();
+
+    // Someone else is pruning
+    if(!haveFile(index) && waitForFile(index))
+      return 0;
+
+    std::map<std::string, cacheEntry> entries;
+    readCacheIndex(entries);
+
+    std::vector<cacheEntry*> lru;
+    uint64_t totalBytes = 0;
+
+    std::map<std::string, cacheEntry>::iterator it = entries.begin();
+
+    while(it != entries.end()){
+      lru.push_back(&(it->second));
+      totalBytes += it->second.bytes;
+      ++it;
+    }
+
+    std::sort(lru.begin(), lru.end(), usedBefore);
+
+    std::vector<std::string> evicted;
+    uint64_t freedBytes = 0;
+
+    const int64_t graceStart = (int64_t) time(NULL) - pruneGraceSeconds;
+
+    for(size_t i = 0; (i < lru.size()) && (maxBytes < totalBytes); ++i){
+      const std::string binary = cachePath + lru[i]->name;
+
+      if(graceStart < lru[i]->lastUse)
+        break;
+
+      // Being built
+      if(!haveFile(binary))
+        continue;
+
+      std::vector<std::string> files;
+      getCacheEntryFiles(binary, files);
+
+      for(size_t f = 0; f < files.size(); ++f)
+        remove(files[f].c_str());
+
+      releaseFile(binary);
+
+      totalBytes -= lru[i]->bytes;
+      freedBytes += lru[i]->bytes;
+
+      evicted.push_back(lru[i]->name);
+    }
+
+    for(size_t i = 0; i < evicted.size(); ++i)
+      entries.erase(evicted[i]);
+
+    writeCacheIndex(entries);
+
+    releaseFile(index);
+
+    return freedBytes;
+  }
+  //==================================
+}
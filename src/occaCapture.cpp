@@ -0,0 +1,363 @@
+#include "occaCapture.hpp"
+
+namespace occa {
+  //---[ Launch Capture ]-------------
+  // Blobs are stored as "<name> <bytes>\n<data>\n"
+  static void writeBlob(std::ofstream &fs,
+                        const std::string &blob){
+    fs << blob.size() << '\n';
+    fs.write(blob.c_str(), blob.size());
+    fs << '\n';
+  }
+
+  static void writeBlob(std::ofstream &fs,
+                        const std::string &name,
+                        const std::string &blob){
+    fs << name << ' ';
+    writeBlob(fs, blob);
+  }
+
+  static bool readBlob(std::istream &in,
+                       std::string &blob){
+    uintptr_t bytes;
+
+    if(!(in >> bytes) || (in.get() != '\n'))
+      return false;
+
+    blob.resize(bytes);
+
+    if(bytes)
+      in.read(&(blob[0]), bytes);
+
+    return (in && (in.get() == '\n'));
+  }
+
+  captureRecord::captureRecord() :
+    dims(0) {}
+
+  bool captureRecord::load(const std::string &filename_){
+    std::ifstream fs(filename_.c_str(), std::ios::in | std::ios::binary);
+
+    if(!fs)
+      return false;
+
+    std::string field;
+
+    if(!(fs >> field) || (field != "occaCapture") ||
+       !(fs >> field) || (field != "v1")){
+      return false;
+    }
+
+    while(fs >> field){
+      if(field == "mode")
+        fs >> mode;
+      else if(field == "function")
+        fs >> functionName;
+      else if(field == "filename")
+        std::getline(fs >> std::ws, filename);
+      else if(field == "source"){
+        if(!readBlob(fs, source))
+          return false;
+      }
+      else if(field == "header"){
+        if(!readBlob(fs, header))
+          return false;
+      }
+      else if(field == "flags"){
+        if(!readBlob(fs, flags))
+          return false;
+      }
+      else if(field == "specializations"){
+        if(!readBlob(fs, specializations))
+          return false;
+      }
+      else if(field == "includeDir"){
+        std::string dir;
+        std::getline(fs >> std::ws, dir);
+
+        includeDirs.push_back(dir);
+      }
+      // "include <path blob> <contents blob>"
+      else if(field == "include"){
+        std::string include, includeSource;
+
+        if(!readBlob(fs, include) || !readBlob(fs, includeSource))
+          return false;
+
+        includes.push_back(include);
+        includeSources.push_back(includeSource);
+      }
+      else if(field == "dims")
+        fs >> dims;
+      else if(field == "inner")
+        fs >> inner.x >> inner.y >> inner.z;
+      else if(field == "outer")
+        fs >> outer.x >> outer.y >> outer.z;
+      else{
+        capturedArg arg;
+
+        if(field == "value"){
+          arg.type = capturedArg::value;
+
+          if(!readBlob(fs, arg.bytes))
+            return false;
+        }
+        else if(field == "buffer"){
+          arg.type = capturedArg::buffer;
+
+          if(!readBlob(fs, arg.bytes))
+            return false;
+        }
+        else if(field == "alias"){
+          arg.type = capturedArg::alias;
+          fs >> arg.aliasOf;
+        }
+        else if(field == "pointer")
+          arg.type = capturedArg::pointer;
+        else
+          return false;
+
+        args.push_back(arg);
+      }
+    }
+
+    return (0 < dims);
+  }
+
+  void captureRecord::save(const std::string &filename_) const {
+    std::stringstream tmpFilename;
+    tmpFilename << filename_ << ".tmp." << this;
+
+    std::ofstream fs(tmpFilename.str().c_str(), std::ios::out | std::ios::binary);
+
+    fs << "occaCapture v1\n"
+       << "mode "     << mode         << '\n'
+       << "function " << functionName << '\n'
+       << "filename " << filename     << '\n';
+
+    writeBlob(fs, "source"         , source);
+    writeBlob(fs, "header"         , header);
+    writeBlob(fs, "flags"          , flags);
+    writeBlob(fs, "specializations", specializations);
+
+    for(size_t i = 0; i < includeDirs.size(); ++i)
+      fs << "includeDir " << includeDirs[i] << '\n';
+
+    for(size_t i = 0; i < includes.size(); ++i){
+      writeBlob(fs, "include", includes[i]);
+      writeBlob(fs, includeSources[i]);
+    }
+
+    fs << "dims "  << dims << '\n'
+       << "inner " << inner.x << ' ' << inner.y << ' ' << inner.z << '\n'
+       << "outer " << outer.x << ' ' << outer.y << ' ' << outer.z << '\n';
+
+    const int argCount = args.size();
+
+    for(int i = 0; i < argCount; ++i){
+      const capturedArg &arg = args[i];
+
+      if(arg.type == capturedArg::value)
+        writeBlob(fs, "value", arg.bytes);
+      else if(arg.type == capturedArg::buffer)
+        writeBlob(fs, "buffer", arg.bytes);
+      else if(arg.type == capturedArg::alias)
+        fs << "alias " << arg.aliasOf << '\n';
+      else
+        fs << "pointer\n";
+    }
+
+    fs.close();
+
+    // Readers never see a partial capture
+    rename(tmpFilename.str().c_str(), filename_.c_str());
+  }
+
+  kernelInfo captureRecord::getKernelInfo() const {
+    kernelInfo info;
+
+    info.header          = header;
+    info.flags           = flags;
+    info.specializations = specializations;
+
+    return info;
+  }
+
+  std::string getCapturePath(){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    return getCachePath() + "captures/";
+#else
+    return getCachePath() + "captures\\";
+#endif
+  }
+
+  // Kernel names and launches picked by OCCA_CAPTURE
+  static std::map<std::string, int>& captureTargets(){
+    static std::map<std::string, int> targets;
+    static bool parsed = false;
+
+    if(parsed)
+      return targets;
+
+    parsed = true;
+
+    char *c_capture = getenv("OCCA_CAPTURE");
+
+    if(c_capture == NULL)
+      return targets;
+
+    std::stringstream ss(c_capture);
+    std::string target;
+
+    while(std::getline(ss, target, ',')){
+      const size_t colon = target.find(':');
+
+      const std::string name = target.substr(0, colon);
+      const int launch       = ((colon == std::string::npos)
+                                ? 1 : atoi(target.c_str() + colon + 1));
+
+      if(name.size() && (0 < launch))
+        targets[name] = launch;
+    }
+
+    return targets;
+  }
+
+  kernelCapture* kernelCapture::start(const std::string &filename,
+                                      const std::string &functionName,
+                                      const kernelInfo &info,
+                                      const std::string &compilerFlags){
+    std::map<std::string, int> &targets = captureTargets();
+    std::map<std::string, int>::iterator it = targets.find(functionName);
+
+    if(it == targets.end())
+      return NULL;
+
+    kernelCapture *kc = new kernelCapture;
+
+    kc->filename     = getCanonicalPath(filename);
+    kc->functionName = functionName;
+    kc->info         = info;
+    kc->launch       = it->second;
+
+    kc->compilerFlags = compilerFlags;
+
+    return kc;
+  }
+
+  void kernelCapture::launched(kernel_v *kHandle,
+                               const kernelArg *args,
+                               const int argCount){
+    // Launches are counted per kernel name, across kernel objects
+    static std::map<std::string, int> launches;
+
+    kernelCapture *kc = kHandle->capture;
+
+    if(++launches[kc->functionName] != kc->launch)
+      return;
+
+    kHandle->capture = NULL;
+
+    captureRecord record;
+
+    record.mode            = kHandle->dev->mode();
+    record.functionName    = kc->functionName;
+    record.filename        = kc->filename;
+    record.source          = readFile(kc->filename);
+    record.header          = kc->info.header;
+    record.flags           = kc->info.flags;
+    record.specializations = kc->info.specializations;
+
+    // Headers are found the way getCachedName finds them
+    const std::string includeFlags = kc->compilerFlags + ' ' + kc->info.flags;
+
+    std::stringstream ss(includeFlags);
+    std::string token;
+
+    while(ss >> token){
+      if(token.compare(0, 2, "-I") != 0)
+        continue;
+
+      std::string dir = token.substr(2);
+
+      if(dir.empty() && !(ss >> dir))
+        break;
+
+      // kernelInfo::addCompilerIncludePath quotes them
+      if((2 < dir.size()) && (dir[0] == '"') && (dir[dir.size() - 1] == '"'))
+        dir = dir.substr(1, dir.size() - 2);
+
+      record.includeDirs.push_back( getCanonicalPath(dir) );
+    }
+
+    std::string prefix, name;
+    getFilePrefixAndName(kc->filename, prefix, name);
+
+    getIncludeClosure(record.source   , prefix, includeFlags, record.includes);
+    getIncludeClosure(kc->info.header , ""    , includeFlags, record.includes);
+
+    for(size_t i = 0; i < record.includes.size(); ++i)
+      record.includeSources.push_back( readFile(record.includes[i]) );
+
+    record.dims  = kHandle->dims;
+    record.inner = kHandle->inner;
+    record.outer = kHandle->outer;
+
+    // Buffers are saved as the launch will see them
+    kHandle->dev->finish();
+
+    for(int i = 0; i < argCount; ++i){
+      const kernelArg &arg = args[i];
+      capturedArg captured;
+
+      if(arg.mHandle != NULL){
+        for(int j = 0; j < i; ++j){
+          if(args[j].mHandle == arg.mHandle){
+            captured.type    = capturedArg::alias;
+            captured.aliasOf = j;
+            break;
+          }
+        }
+
+        if(captured.type != capturedArg::alias){
+          captured.type = capturedArg::buffer;
+          captured.bytes.resize(arg.mHandle->size);
+
+          if(arg.mHandle->size)
+            arg.mHandle->copyTo(&(captured.bytes[0]), arg.mHandle->size);
+        }
+      }
+      else if(arg.pointer)
+        captured.type = capturedArg::pointer;
+      else
+        captured.bytes.assign((const char*) arg.data(), arg.size);
+
+      record.args.push_back(captured);
+    }
+
+    const std::string capturePath = getCapturePath();
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    mkdir(capturePath.c_str(), 0755);
+#else
+    CreateDirectoryA(capturePath.c_str(), NULL);
+#endif
+
+    std::stringstream captureName;
+    captureName << capturePath << kc->functionName << '_' << kc->launch << ".capture";
+
+    record.save(captureName.str());
+
+    std::cout << "Captured launch " << kc->launch << " of [" << kc->functionName << "] in ["
+              << captureName.str() << "]\n";
+
+    delete kc;
+  }
+
+  void freeKernelCapture(kernel_v *kHandle){
+    delete kHandle->capture;
+
+    kHandle->capture = NULL;
+  }
+  //==================================
+}
@@ -0,0 +1,332 @@
+#include "occaCompiler.hpp"
+#include "occaTools.hpp"
+#include "occaBase.hpp"
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include <iostream>
+#include <sstream>
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+#  include <spawn.h>
+#  include <unistd.h>
+#  include <sys/wait.h>
+#  include <sys/stat.h>
+#  include <sys/socket.h>
+#  include <sys/un.h>
+
+extern char **environ;
+#endif
+
+namespace occa {
+  //---[ Compiler Backends ]----------
+  std::string systemCompiler::name(){
+    return "system";
+  }
+
+  int systemCompiler::compile(const std::string & /*source*/,
+                              const std::string & /*binary*/,
+                              const std::string &command){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    return system(command.c_str());
+#else
+    return system(("\"" + command + "\"").c_str());
+#endif
+  }
+
+  std::string spawnCompiler::name(){
+    return "spawn";
+  }
+
+  bool spawnCompiler::splitCommand(const std::string &command,
+                                   std::vector<std::string> &args){
+    const char *c = command.c_str();
+
+    while(*c){
+      while((*c == ' ') || (*c == '\t') || (*c == '\n') || (*c == '\r'))
+        ++c;
+
+      if(*c == '\0')
+        break;
+
+      std::string arg;
+
+      while(*c && (*c != ' ') && (*c != '\t') && (*c != '\n') && (*c != '\r')){
+        if(strchr("&|;<>()$`*?~{}!#", *c))
+          return false;
+
+        if((*c == '\'') || (*c == '"')){
+          const char quote = *(c++);
+
+          while(*c && (*c != quote)){
+            if((quote == '"') && ((*c == '$') || (*c == '`')))
+              return false;
+
+            if((quote == '"') && (*c == '\\') && c[1])
+              ++c;
+
+            arg += *(c++);
+          }
+
+          if(*c == '\0')
+            return false;
+
+          ++c;
+        }
+        else if(*c == '\\'){
+          if(c[1] == '\0')
+            return false;
+
+          arg += c[1];
+          c += 2;
+        }
+        else
+          arg += *(c++);
+      }
+
+      args.push_back(arg);
+    }
+
+    return (0 < args.size());
+  }
+
+  int spawnCompiler::compile(const std::string &source,
+                             const std::string &binary,
+                             const std::string &command){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    std::vector<std::string> args;
+
+    if(!splitCommand(command, args))
+      return systemCompiler().compile(source, binary, command);
+
+    const int argCount = args.size();
+    std::vector<char*> argv(argCount + 1, (char*) NULL);
+
+    for(int i = 0; i < argCount; ++i)
+      argv[i] = (char*) args[i].c_str();
+
+    pid_t pid;
+
+    if(posix_spawnp(&pid, argv[0], NULL, NULL, &(argv[0]), environ) != 0)
+      return -1;
+
+    int status;
+
+    while(waitpid(pid, &status, 0) < 0){
+      if(errno != EINTR)
+        return -1;
+    }
+
+    return (WIFEXITED(status) ? WEXITSTATUS(status) : -1);
+#else
+    return systemCompiler().compile(source, binary, command);
+#endif
+  }
+
+  static compilerBackend *installedBackend = NULL;
+
+  compilerBackend& getCompilerBackend(){
+    static systemCompiler systemBackend;
+    static spawnCompiler spawnBackend;
+
+    if(installedBackend != NULL)
+      return *installedBackend;
+
+    char *c_backend = getenv("OCCA_COMPILER_BACKEND");
+
+    if((c_backend != NULL) && (std::string(c_backend) == "system"))
+      return systemBackend;
+
+    return spawnBackend;
+  }
+
+  void setCompilerBackend(compilerBackend *backend){
+    installedBackend = backend;
+  }
+  //==================================
+
+
+  //---[ Compile Server ]-------------
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+  static int connectToServer(const std::string &socketPath){
+    struct sockaddr_un address;
+
+    if(sizeof(address.sun_path) <= socketPath.size())
+      return -1;
+
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, socketPath.c_str());
+
+    const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if(fd < 0)
+      return -1;
+
+#ifdef SO_NOSIGPIPE
+    const int noSigPipe = 1;
+    setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif
+
+    if(connect(fd, (struct sockaddr*) &address, sizeof(address)) != 0){
+      close(fd);
+      return -1;
+    }
+
+    return fd;
+  }
+#endif
+
+  bool compileServer::sendField(const int fd, const std::string &field){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    std::stringstream ss;
+    ss << field.size() << '\n' << field;
+
+    const std::string message = ss.str();
+
+    const char *c    = message.c_str();
+    size_t bytesLeft = message.size();
+
+#ifdef MSG_NOSIGNAL
+    const int flags = MSG_NOSIGNAL;
+#else
+    const int flags = 0;
+#endif
+
+    while(bytesLeft){
+      const ssize_t bytes = send(fd, c, bytesLeft, flags);
+
+      if(bytes < 0){
+        if(errno == EINTR)
+          continue;
+
+        return false;
+      }
+
+      c         += bytes;
+      bytesLeft -= bytes;
+    }
+
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  bool compileServer::recvField(const int fd, std::string &field){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    size_t bytesLeft = 0;
+    char c;
+
+    while(true){
+      const ssize_t bytes = recv(fd, &c, 1, 0);
+
+      if((bytes < 0) && (errno == EINTR))
+        continue;
+
+      if(bytes <= 0)
+        return false;
+
+      if(c == '\n')
+        break;
+
+      if((c < '0') || ('9' < c))
+        return false;
+
+      bytesLeft = (10*bytesLeft) + (c - '0');
+
+      if(maxFieldBytes < bytesLeft)
+        return false;
+    }
+
+    field.resize(bytesLeft);
+
+    size_t offset = 0;
+
+    while(offset < bytesLeft){
+      const ssize_t bytes = recv(fd, &(field[offset]), bytesLeft - offset, 0);
+
+      if((bytes < 0) && (errno == EINTR))
+        continue;
+
+      if(bytes <= 0)
+        return false;
+
+      offset += bytes;
+    }
+
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  bool compileServer::build(const std::string &mode,
+                            const std::string &filename,
+                            const std::string &functionName,
+                            const kernelInfo &info,
+                            const std::string &cachedBinary){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    char *c_server = getenv("OCCA_COMPILE_SERVER");
+
+    if((c_server == NULL) || (*c_server == '\0'))
+      return false;
+
+    const int fd = connectToServer(c_server);
+
+    if(fd < 0)
+      return false;
+
+    std::string status, message;
+
+    const bool answered = (sendField(fd, mode)                       &&
+                           sendField(fd, getCanonicalPath(filename)) &&
+                           sendField(fd, functionName)               &&
+                           sendField(fd, info.occaKeywords)          &&
+                           sendField(fd, info.header)                &&
+                           sendField(fd, info.flags)                 &&
+                           sendField(fd, info.specializations)       &&
+                           sendField(fd, cachedBinary)               &&
+                           recvField(fd, status)                     &&
+                           recvField(fd, message));
+
+    close(fd);
+
+    if(!answered)
+      return false;
+
+    if(status != "0"){
+      std::cerr << "occa-compile-server: " << message
+                << ", building [" << functionName << "] in-process\n";
+      return false;
+    }
+
+    struct stat buffer;
+    return (stat(cachedBinary.c_str(), &buffer) == 0);
+#else
+    return false;
+#endif
+  }
+
+  bool compileServer::buildHere(device &dev,
+                                const std::string &filename,
+                                const std::string &functionName,
+                                const kernelInfo &info){
+    kernel_v *kHandle = NULL;
+
+    try {
+      kHandle = dev.dHandle->buildKernelFromSource(filename, functionName, info);
+    }
+    catch(...){
+      return false;
+    }
+
+    kHandle->free();
+    delete kHandle;
+
+    return true;
+  }
+  //==================================
+}
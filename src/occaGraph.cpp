@@ -0,0 +1,264 @@
+#include "occaGraph.hpp"
+
+namespace occa {
+  //---[ Kernel Graphs ]--------------
+  bool graph_v::captureLaunch(kernel_v *kHandle,
+                              const kernelArg *args,
+                              const int argCount){
+    graph_v *graph = kHandle->dev->dHandle->graph;
+
+    if(graph == NULL)
+      return false;
+
+    graphNode node;
+
+    node.type    = graphNode::launch;
+    node.s       = kHandle->dev->currentStream;
+    node.kHandle = kHandle;
+
+    node.dims  = kHandle->dims;
+    node.inner = kHandle->inner;
+    node.outer = kHandle->outer;
+
+    node.argCount = argCount;
+
+    for(int i = 0; i < argCount; ++i)
+      node.args[i] = args[i];
+
+    graph->nodes.push_back(node);
+
+    return true;
+  }
+
+  bool graph_v::captureCopy(occa::device *dev,
+                            memory_v *destMem, void *destPtr,
+                            memory_v *srcMem, const void *srcPtr,
+                            const uintptr_t bytes,
+                            const uintptr_t destOffset,
+                            const uintptr_t srcOffset){
+    graph_v *graph = dev->dHandle->graph;
+
+    if(graph == NULL)
+      return false;
+
+    OCCA_CHECK((destMem == NULL) || ((bytes + destOffset) <= destMem->size));
+    OCCA_CHECK((srcMem  == NULL) || ((bytes + srcOffset)  <= srcMem->size));
+
+    graphNode node;
+
+    node.type = graphNode::copy;
+    node.s    = dev->currentStream;
+
+    node.destMem = destMem;
+    node.destPtr = destPtr;
+    node.srcMem  = srcMem;
+    node.srcPtr  = srcPtr;
+
+    node.bytes      = bytes;
+    node.destOffset = destOffset;
+    node.srcOffset  = srcOffset;
+
+    graph->nodes.push_back(node);
+
+    return true;
+  }
+
+  bool graph_v::captureFill(occa::device *dev,
+                            memory_v *destMem,
+                            const void *pattern,
+                            const uintptr_t patternBytes,
+                            const uintptr_t bytes,
+                            const uintptr_t destOffset){
+    graph_v *graph = dev->dHandle->graph;
+
+    if(graph == NULL)
+      return false;
+
+    OCCA_CHECK((bytes + destOffset) <= destMem->size);
+
+    graphNode node;
+
+    node.type = graphNode::fill;
+    node.s    = dev->currentStream;
+
+    node.destMem    = destMem;
+    node.bytes      = bytes;
+    node.destOffset = destOffset;
+
+    // The caller's pattern can be gone by the time the graph runs
+    node.pattern.assign((const char*) pattern, patternBytes);
+
+    graph->nodes.push_back(node);
+
+    return true;
+  }
+
+  bool graph_v::captureIndexedCopy(occa::device *dev,
+                                   const graphNode::nodeType type,
+                                   memory_v *destMem,
+                                   memory_v *srcMem,
+                                   memory_v *indicesMem,
+                                   const uintptr_t entryBytes,
+                                   const uintptr_t entries){
+    graph_v *graph = dev->dHandle->graph;
+
+    if(graph == NULL)
+      return false;
+
+    graphNode node;
+
+    node.type = type;
+    node.s    = dev->currentStream;
+
+    node.destMem    = destMem;
+    node.srcMem     = srcMem;
+    node.indicesMem = indicesMem;
+    node.entryBytes = entryBytes;
+    node.entries    = entries;
+
+    graph->nodes.push_back(node);
+
+    return true;
+  }
+
+  bool graph_v::captureFinish(occa::device *dev){
+    graph_v *graph = dev->dHandle->graph;
+
+    if(graph == NULL)
+      return false;
+
+    graphNode node;
+
+    node.type = graphNode::barrier;
+    node.s    = dev->currentStream;
+
+    graph->nodes.push_back(node);
+
+    return true;
+  }
+
+  void graph_v::run(){
+    dev->dHandle->runGraph(*this);
+  }
+
+  void graph_v::dropPlan(){
+    if(plan == NULL)
+      return;
+
+    dev->dHandle->finish();
+
+    delete plan;
+    plan = NULL;
+  }
+
+  void graph_v::runNodes(){
+    const stream originalStream = dev->currentStream;
+
+    const int nodeCount = nodes.size();
+
+    for(int n = 0; n < nodeCount; ++n){
+      graphNode &node = nodes[n];
+
+      dev->currentStream = node.s;
+
+      if(node.type == graphNode::launch){
+        kernel_v *launchedHandle = node.kHandle;
+
+        const int argumentCount   = node.argCount;
+        const kernelArg *arguments = node.args;
+
+        // Launches read their dims from the handle, which keeps its own
+        const int dims = launchedHandle->dims;
+        const dim inner(launchedHandle->inner), outer(launchedHandle->outer);
+
+        launchedHandle->dims  = node.dims;
+        launchedHandle->inner = node.inner;
+        launchedHandle->outer = node.outer;
+
+#include "operators/occaRunFromArguments.cpp"
+
+        launchedHandle->dims  = dims;
+        launchedHandle->inner = inner;
+        launchedHandle->outer = outer;
+      }
+      else if(node.type == graphNode::copy){
+        if(node.destMem == NULL)
+          node.srcMem->asyncCopyTo(node.destPtr, node.bytes, node.srcOffset);
+        else if(node.srcMem == NULL)
+          node.destMem->asyncCopyFrom(node.srcPtr, node.bytes, node.destOffset);
+        else
+          node.destMem->asyncCopyFrom(node.srcMem, node.bytes, node.destOffset, node.srcOffset);
+      }
+      else if(node.type == graphNode::fill)
+        node.destMem->fill(node.pattern.c_str(), node.pattern.size(), node.bytes, node.destOffset);
+      else if(node.type == graphNode::gather)
+        node.srcMem->gather(node.destMem, node.indicesMem, node.entryBytes, node.entries);
+      else if(node.type == graphNode::scatter)
+        node.srcMem->scatter(node.destMem, node.indicesMem, node.entryBytes, node.entries);
+      else
+        dev->dHandle->finish();
+    }
+
+    dev->currentStream = originalStream;
+  }
+
+  kernelGraph::kernelGraph() :
+    gHandle(NULL) {}
+
+  kernelGraph::kernelGraph(const kernelGraph &g) :
+    gHandle(g.gHandle) {}
+
+  kernelGraph& kernelGraph::operator = (const kernelGraph &g){
+    gHandle = g.gHandle;
+
+    return *this;
+  }
+
+  int kernelGraph::nodeCount(){
+    return gHandle->nodes.size();
+  }
+
+  void kernelGraph::setArgument(const int node,
+                                const int argPos,
+                                const kernelArg &arg){
+    OCCA_CHECK((0 <= node) && (node < (int) gHandle->nodes.size()));
+
+    graphNode &gNode = gHandle->nodes[node];
+
+    OCCA_CHECK(gNode.type == graphNode::launch);
+    OCCA_CHECK((0 <= argPos) && (argPos < gNode.argCount));
+
+    gNode.args[argPos] = arg;
+
+    // Rebuilt on the next replay
+    gHandle->dropPlan();
+  }
+
+  void kernelGraph::run(){
+    gHandle->run();
+  }
+
+  void kernelGraph::free(){
+    delete gHandle;
+    gHandle = NULL;
+  }
+
+  void device::beginCapture(){
+    OCCA_CHECK(dHandle->graph == NULL);
+
+    dHandle->graph      = new graph_v;
+    dHandle->graph->dev = this;
+  }
+
+  kernelGraph device::endCapture(){
+    OCCA_CHECK(dHandle->graph != NULL);
+
+    kernelGraph graph;
+
+    graph.gHandle  = dHandle->graph;
+    dHandle->graph = NULL;
+
+    return graph;
+  }
+  //==================================
+}
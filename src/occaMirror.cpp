@@ -0,0 +1,169 @@
+#include "occaMirror.hpp"
+
+namespace occa {
+  //---[ Mirror ]---------------------
+  mirror::mirror() :
+    mHandle(new mirror_v) {}
+
+  mirror::mirror(occa::device &dev,
+                 const uintptr_t bytes,
+                 const void *source) :
+    mHandle(new mirror_v) {
+
+    allocate(dev, bytes, source);
+  }
+
+  mirror::mirror(const mirror &m) :
+    mHandle(m.mHandle) {
+
+    ++(mHandle->refs);
+  }
+
+  mirror& mirror::operator = (const mirror &m){
+    ++(m.mHandle->refs);
+
+    if(--(mHandle->refs) == 0)
+      delete mHandle;
+
+    mHandle = m.mHandle;
+
+    return *this;
+  }
+
+  mirror::~mirror(){
+    if(--(mHandle->refs) == 0)
+      delete mHandle;
+  }
+
+  void mirror::allocate(occa::device &dev,
+                        const uintptr_t bytes,
+                        const void *source){
+    mirror_v &m = *mHandle;
+
+    m.mem  = dev.malloc(bytes, (void*) source);
+    m.size = bytes;
+
+    m.zeroCopy = (m.mem.mode_ & (Pthreads | OpenMP));
+
+    if(m.zeroCopy)
+      m.hostPtr = (char*) m.mem.mHandle->handle;
+    else{
+      m.hostPtr = new char[bytes];
+
+      if(source != NULL)
+        ::memcpy(m.hostPtr, source, bytes);
+    }
+
+    m.state = inSync;
+  }
+
+  void mirror::syncToHost(){
+    mirror_v &m = *mHandle;
+
+    if(m.state != deviceDirty)
+      return;
+
+    // Kernels might still be writing to the shared buffer
+    if(m.zeroCopy){
+      m.mem.mHandle->dev->finish();
+      ++(m.avoidedTransfers);
+    }
+    else{
+      m.mem.copyTo(m.hostPtr);
+      ++(m.transfers);
+    }
+
+    m.state = inSync;
+  }
+
+  void mirror::syncToDevice(){
+    mirror_v &m = *mHandle;
+
+    if(m.state != hostDirty)
+      return;
+
+    if(m.zeroCopy)
+      ++(m.avoidedTransfers);
+    else{
+      m.mem.copyFrom(m.hostPtr);
+      ++(m.transfers);
+    }
+
+    m.state = inSync;
+  }
+
+  void* mirror::host(){
+    syncToHost();
+    mHandle->state = hostDirty;
+
+    return mHandle->hostPtr;
+  }
+
+  const void* mirror::hostRead(){
+    syncToHost();
+
+    return mHandle->hostPtr;
+  }
+
+  void* mirror::hostWrite(){
+    mirror_v &m = *mHandle;
+
+    if(m.zeroCopy && (m.state == deviceDirty))
+      m.mem.mHandle->dev->finish();
+
+    m.state = hostDirty;
+
+    return m.hostPtr;
+  }
+
+  void mirror::hostModified(){
+    mHandle->state = hostDirty;
+  }
+
+  kernelArg mirror::read(){
+    syncToDevice();
+
+    return kernelArg(mHandle->mem);
+  }
+
+  kernelArg mirror::write(){
+    mHandle->state = deviceDirty;
+
+    return kernelArg(mHandle->mem);
+  }
+
+  mirror::operator kernelArg (){
+    syncToDevice();
+    mHandle->state = deviceDirty;
+
+    return kernelArg(mHandle->mem);
+  }
+
+  occa::memory& mirror::deviceMemory(){
+    syncToDevice();
+    mHandle->state = deviceDirty;
+
+    return mHandle->mem;
+  }
+
+  void mirror::deviceModified(){
+    mHandle->state = deviceDirty;
+  }
+
+  void mirror::free(){
+    mirror_v &m = *mHandle;
+
+    if(m.size == 0)
+      return;
+
+    if(!m.zeroCopy)
+      delete [] m.hostPtr;
+
+    m.mem.free();
+
+    m.hostPtr = NULL;
+    m.size    = 0;
+    m.state   = inSync;
+  }
+  //==================================
+};
@@ -1,6 +1,7 @@
 #if OCCA_OPENCL_ENABLED
 
 #include "occaOpenCL.hpp"
+#include "occaGraph.hpp"
 
 namespace occa {
   //---[ Helper Functions ]-----------
@@ -195,6 +196,89 @@ namespace occa {
 
       return dInfo;
     }
+
+    static const char *memoryKernelsSource =
+      "__kernel void occaGather(__global char *dest,\n"
+      "                         __global const char *src,\n"
+      "                         __global const int *indices,\n"
+      "                         const ulong entryBytes,\n"
+      "                         const ulong entries){\n"
+      "  const ulong i = get_global_id(0);\n"
+      "  if(i < entries){\n"
+      "    __global char *d       = dest + i*entryBytes;\n"
+      "    __global const char *s = src  + indices[i]*entryBytes;\n"
+      "    for(ulong b = 0; b < entryBytes; ++b)\n"
+      "      d[b] = s[b];\n"
+      "  }\n"
+      "}\n"
+      "\n"
+      "__kernel void occaScatter(__global char *dest,\n"
+      "                          __global const char *src,\n"
+      "                          __global const int *indices,\n"
+      "                          const ulong entryBytes,\n"
+      "                          const ulong entries){\n"
+      "  const ulong i = get_global_id(0);\n"
+      "  if(i < entries){\n"
+      "    __global char *d       = dest + indices[i]*entryBytes;\n"
+      "    __global const char *s = src  + i*entryBytes;\n"
+      "    for(ulong b = 0; b < entryBytes; ++b)\n"
+      "      d[b] = s[b];\n"
+      "  }\n"
+      "}\n";
+
+    void buildMemoryKernels(OpenCLDeviceData_t &data_){
+      if(data_.memoryProgram != NULL)
+        return;
+
+      cl_int error;
+
+      const uintptr_t sourceLength = strlen(memoryKernelsSource);
+
+      data_.memoryProgram = clCreateProgramWithSource(data_.context, 1,
+                                                      &memoryKernelsSource,
+                                                      &sourceLength, &error);
+      OCCA_CL_CHECK("Device: Constructing Memory Program", error);
+
+      OCCA_CL_CHECK("Device: Building Memory Program",
+                    clBuildProgram(data_.memoryProgram,
+                                   1, &data_.deviceID,
+                                   "", NULL, NULL));
+
+      data_.gatherKernel = clCreateKernel(data_.memoryProgram, "occaGather", &error);
+      OCCA_CL_CHECK("Device: Creating Gather Kernel", error);
+
+      data_.scatterKernel = clCreateKernel(data_.memoryProgram, "occaScatter", &error);
+      OCCA_CL_CHECK("Device: Creating Scatter Kernel", error);
+    }
+
+    void runIndexKernel(cl_command_queue &stream,
+                        cl_kernel kernel,
+                        cl_mem dest, cl_mem src, cl_mem indices,
+                        const uintptr_t entryBytes,
+                        const uintptr_t entries){
+      const cl_ulong entryBytes_ = entryBytes;
+      const cl_ulong entries_    = entries;
+
+      OCCA_CL_CHECK("Memory: Setting Index Kernel Arguments",
+                    clSetKernelArg(kernel, 0, sizeof(cl_mem), &dest));
+      OCCA_CL_CHECK("Memory: Setting Index Kernel Arguments",
+                    clSetKernelArg(kernel, 1, sizeof(cl_mem), &src));
+      OCCA_CL_CHECK("Memory: Setting Index Kernel Arguments",
+                    clSetKernelArg(kernel, 2, sizeof(cl_mem), &indices));
+      OCCA_CL_CHECK("Memory: Setting Index Kernel Arguments",
+                    clSetKernelArg(kernel, 3, sizeof(cl_ulong), &entryBytes_));
+      OCCA_CL_CHECK("Memory: Setting Index Kernel Arguments",
+                    clSetKernelArg(kernel, 4, sizeof(cl_ulong), &entries_));
+
+      const uintptr_t localSize  = 256;
+      const uintptr_t globalSize = localSize * ((entries + localSize - 1) / localSize);
+
+      OCCA_CL_CHECK("Memory: Index Kernel Run",
+                    clEnqueueNDRangeKernel(stream, kernel,
+                                           1, NULL,
+                                           &globalSize, &localSize,
+                                           0, NULL, NULL));
+    }
   };
   //==================================
 
@@ -256,6 +340,61 @@ namespace occa {
   template <>
   kernel_t<OpenCL>::~kernel_t(){}
 
+  //---[ Program Cache ]--------------
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+  static pthread_mutex_t programMutex = PTHREAD_MUTEX_INITIALIZER;
+
+  static inline void lockPrograms(){
+    pthread_mutex_lock(&programMutex);
+  }
+
+  static inline void unlockPrograms(){
+    pthread_mutex_unlock(&programMutex);
+  }
+#else
+  static inline void lockPrograms(){}
+  static inline void unlockPrograms(){}
+#endif
+
+  static bool findProgram(OpenCLDeviceData_t &dData,
+                          const std::string &binary,
+                          cl_program &program){
+    lockPrograms();
+
+    std::map<std::string, cl_program>::iterator it = dData.programs.find(binary);
+
+    const bool found = (it != dData.programs.end());
+
+    if(found)
+      program = it->second;
+
+    unlockPrograms();
+
+    return found;
+  }
+
+  // If another thread loaded [binary] first, its program is used instead
+  static cl_program keepProgram(OpenCLDeviceData_t &dData,
+                                const std::string &binary,
+                                cl_program program){
+    lockPrograms();
+
+    std::map<std::string, cl_program>::iterator it = dData.programs.find(binary);
+
+    if(it == dData.programs.end()){
+      dData.programs[binary] = program;
+    }
+    else{
+      clReleaseProgram(program);
+      program = it->second;
+    }
+
+    unlockPrograms();
+
+    return program;
+  }
+  //==================================
+
   template <>
   kernel_t<OpenCL>* kernel_t<OpenCL>::buildFromSource(const std::string &filename,
                                                       const std::string &functionName_,
@@ -275,24 +414,24 @@ namespace occa {
          << data_.platform << '-' << data_.device
          << info.salt()
          << dev->dHandle->compiler
-         << dev->dHandle->compilerFlags
-         << functionName;
+         << dev->dHandle->compilerFlags;
+
+    std::string cachedBinary = getCachedName(filename, salt.str(), "OpenCL",
+                                             dev->dHandle->compilerFlags + ' ' + info.flags);
 
-    std::string cachedBinary = getCachedName(filename, salt.str());
+    OpenCLDeviceData_t &dData = *((OpenCLDeviceData_t*) dev->dHandle->data);
 
     struct stat buffer;
     const bool fileExists = (stat(cachedBinary.c_str(), &buffer) == 0);
 
-    if(fileExists){
+    if(fileExists || findProgram(dData, cachedBinary, data_.program)){
       std::cout << "Found cached binary of [" << filename << "] in [" << cachedBinary << "]\n";
       return buildFromBinary(cachedBinary, functionName);
     }
 
-    if(!haveFile(cachedBinary)){
-      waitForFile(cachedBinary);
-
+    // Someone else is making it (or failed to, then it's ours to make)
+    if(!haveFile(cachedBinary) && waitForFile(cachedBinary))
       return buildFromBinary(cachedBinary, functionName);
-    }
 
     std::string iCachedBinary = createIntermediateSource(filename,
                                                          cachedBinary,
@@ -390,6 +529,8 @@ namespace occa {
       delete [] binary;
     }
 
+    data_.program = keepProgram(dData, cachedBinary, data_.program);
+
     data_.kernel = clCreateKernel(data_.program, functionName.c_str(), &error);
 
     if(error)
@@ -415,6 +556,16 @@ namespace occa {
 
     cl_int binaryError, error;
 
+    OpenCLDeviceData_t &dData = *((OpenCLDeviceData_t*) dev->dHandle->data);
+
+    // Another kernel of the binary already built its program
+    if(findProgram(dData, filename, data_.program)){
+      data_.kernel = clCreateKernel(data_.program, functionName.c_str(), &error);
+      OCCA_CL_CHECK("Kernel (" + functionName + "): Creating Kernel", error);
+
+      return this;
+    }
+
     int fileHandle = ::open(filename.c_str(), O_RDWR);
     if(fileHandle == 0){
       printf("File [ %s ] does not exist.\n", filename.c_str());
@@ -473,6 +624,8 @@ namespace occa {
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Building Program", error);
 
+    data_.program = keepProgram(dData, filename, data_.program);
+
     data_.kernel = clCreateKernel(data_.program, functionName.c_str(), &error);
     OCCA_CL_CHECK("Kernel (" + functionName + "): Creating Kernel", error);
 
@@ -521,6 +674,11 @@ namespace occa {
     return 1.0e-9*(end - start);
   }
 
+  template <>
+  bool kernel_t<OpenCL>::dumpProfile(){
+    return false;
+  }
+
   template <>
   void kernel_t<OpenCL>::free(){
   }
@@ -640,6 +798,7 @@ namespace occa {
 
     OCCA_CHECK((bytes_ + offset) <= size);
 
+    // The driver DMAs mapped device::mallocHost sources directly, other ones are staged
     OCCA_CL_CHECK("Memory: Asynchronous Copy From",
                   clEnqueueWriteBuffer(stream, *((cl_mem*) handle),
                                        CL_FALSE,
@@ -678,6 +837,7 @@ namespace occa {
 
     OCCA_CHECK((bytes_ + offset) <= size);
 
+    // The driver DMAs into mapped device::mallocHost destinations directly, other ones are staged
     OCCA_CL_CHECK("Memory: Asynchronous Copy To",
                   clEnqueueReadBuffer(stream, *((cl_mem*) handle),
                                       CL_FALSE,
@@ -706,6 +866,81 @@ namespace occa {
                                       0, NULL, NULL));
   }
 
+  template <>
+  void memory_t<OpenCL>::fill(const void *pattern,
+                              const uintptr_t patternBytes,
+                              const uintptr_t bytes,
+                              const uintptr_t offset){
+    cl_command_queue &stream = *((cl_command_queue*) dev->currentStream);
+
+    const uintptr_t bytes_ = (bytes == 0) ? size : bytes;
+
+    OCCA_CHECK((bytes_ + offset) <= size);
+
+#ifdef CL_VERSION_1_2
+    // clEnqueueFillBuffer takes power-of-two patterns up to 128 bytes
+    const bool nativeFill = ((patternBytes <= 128)                      &&
+                             ((patternBytes & (patternBytes - 1)) == 0) &&
+                             ((offset % patternBytes) == 0)             &&
+                             ((bytes_ % patternBytes) == 0));
+
+    if(nativeFill){
+      OCCA_CL_CHECK("Memory: Fill",
+                    clEnqueueFillBuffer(stream, *((cl_mem*) handle),
+                                        pattern, patternBytes,
+                                        offset, bytes_,
+                                        0, NULL, NULL));
+      return;
+    }
+#endif
+
+    char *buffer = new char[bytes_];
+
+    occa::memFill(buffer, pattern, patternBytes, bytes_);
+
+    OCCA_CL_CHECK("Memory: Fill",
+                  clEnqueueWriteBuffer(stream, *((cl_mem*) handle),
+                                       CL_TRUE,
+                                       offset, bytes_, buffer,
+                                       0, NULL, NULL));
+
+    delete [] buffer;
+  }
+
+  template <>
+  void memory_t<OpenCL>::gather(memory_v *dest,
+                                const memory_v *indices,
+                                const uintptr_t entryBytes,
+                                const uintptr_t entries){
+    OpenCLDeviceData_t &dData = *((OpenCLDeviceData_t*) dev->dHandle->data);
+    cl_command_queue &stream  = *((cl_command_queue*) dev->currentStream);
+
+    cl::buildMemoryKernels(dData);
+
+    cl::runIndexKernel(stream, dData.gatherKernel,
+                       *((cl_mem*) dest->handle),
+                       *((cl_mem*) handle),
+                       *((cl_mem*) indices->handle),
+                       entryBytes, entries);
+  }
+
+  template <>
+  void memory_t<OpenCL>::scatter(memory_v *dest,
+                                 const memory_v *indices,
+                                 const uintptr_t entryBytes,
+                                 const uintptr_t entries){
+    OpenCLDeviceData_t &dData = *((OpenCLDeviceData_t*) dev->dHandle->data);
+    cl_command_queue &stream  = *((cl_command_queue*) dev->currentStream);
+
+    cl::buildMemoryKernels(dData);
+
+    cl::runIndexKernel(stream, dData.scatterKernel,
+                       *((cl_mem*) dest->handle),
+                       *((cl_mem*) handle),
+                       *((cl_mem*) indices->handle),
+                       entryBytes, entries);
+  }
+
   template <>
   void memory_t<OpenCL>::free(){
     clReleaseMemObject(*((cl_mem*) handle));
@@ -747,7 +982,8 @@ namespace occa {
   template <>
   device_t<OpenCL>::device_t(){
     data = NULL;
-    memoryAllocated = 0;
+    memoryAllocated     = 0;
+    hostMemoryAllocated = 0;
 
     getEnvironmentVariables();
   }
@@ -755,23 +991,28 @@ namespace occa {
   template <>
   device_t<OpenCL>::device_t(int platform, int device){
     data = NULL;
-    memoryAllocated = 0;
+    memoryAllocated     = 0;
+    hostMemoryAllocated = 0;
 
     getEnvironmentVariables();
   }
 
   template <>
   device_t<OpenCL>::device_t(const device_t<OpenCL> &d){
-    data            = d.data;
-    memoryAllocated = d.memoryAllocated;
+    data                = d.data;
+    memoryAllocated     = d.memoryAllocated;
+    hostMemoryAllocated = d.hostMemoryAllocated;
+    pinnedBuffers       = d.pinnedBuffers;
 
     compilerFlags = d.compilerFlags;
   }
 
   template <>
   device_t<OpenCL>& device_t<OpenCL>::operator = (const device_t<OpenCL> &d){
-    data            = d.data;
-    memoryAllocated = d.memoryAllocated;
+    data                = d.data;
+    memoryAllocated     = d.memoryAllocated;
+    hostMemoryAllocated = d.hostMemoryAllocated;
+    pinnedBuffers       = d.pinnedBuffers;
 
     compilerFlags = d.compilerFlags;
 
@@ -793,6 +1034,8 @@ namespace occa {
 
     data_.context = clCreateContext(NULL, 1, &data_.deviceID, NULL, NULL, &error);
     OCCA_CL_CHECK("Device: Creating Context", error);
+
+    data_.memoryProgram = NULL;
   }
 
   template <>
@@ -982,10 +1225,95 @@ namespace occa {
     return mem;
   }
 
+  template <>
+  memory_v* device_t<OpenCL>::mapFile(const std::string &filename,
+                                      const uintptr_t offset,
+                                      const uintptr_t bytes,
+                                      const int flags){
+    // Stage through a read-only host mapping, skipping the intermediate read
+    uintptr_t bytes_ = bytes;
+    void *mappedPtr;
+    uintptr_t mappedBytes;
+
+    void *source = occa::mapFile(filename, offset, bytes_, occa::mapReadOnly | occa::mapSequential,
+                                 mappedPtr, mappedBytes);
+
+    memory_v *mem = malloc(bytes_, source);
+
+    occa::unmapFile(mappedPtr, mappedBytes);
+
+    return mem;
+  }
+
+  template <>
+  pinnedBuffer device_t<OpenCL>::mallocHost(const uintptr_t bytes){
+    OCCA_EXTRACT_DATA(OpenCL, Device);
+
+    cl_command_queue &stream = *((cl_command_queue*) dev->currentStream);
+
+    pinnedBuffer buffer;
+    cl_int error;
+
+    buffer.bytes  = bytes;
+    buffer.handle = new cl_mem;
+
+    cl_mem &clMem = *((cl_mem*) buffer.handle);
+
+    // Drivers back ALLOC_HOST_PTR buffers with page-locked memory
+    clMem = clCreateBuffer(data_.context,
+                           CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR,
+                           bytes, NULL, &error);
+
+    OCCA_CL_CHECK("Device: mallocHost", error);
+
+    buffer.ptr = clEnqueueMapBuffer(stream, clMem,
+                                    CL_TRUE,
+                                    CL_MAP_READ | CL_MAP_WRITE,
+                                    0, bytes,
+                                    0, NULL, NULL,
+                                    &error);
+
+    OCCA_CL_CHECK("Device: mallocHost", error);
+
+    return buffer;
+  }
+
+  template <>
+  void device_t<OpenCL>::freeHost(pinnedBuffer &buffer){
+    cl_command_queue &stream = *((cl_command_queue*) dev->currentStream);
+
+    cl_mem &clMem = *((cl_mem*) buffer.handle);
+
+    OCCA_CL_CHECK("Device: freeHost",
+                  clEnqueueUnmapMemObject(stream, clMem, buffer.ptr,
+                                          0, NULL, NULL) );
+
+    OCCA_CL_CHECK("Device: freeHost",
+                  clFinish(stream) );
+
+    OCCA_CL_CHECK("Device: freeHost",
+                  clReleaseMemObject(clMem) );
+
+    delete (cl_mem*) buffer.handle;
+  }
+
   template <>
   void device_t<OpenCL>::free(){
     OCCA_EXTRACT_DATA(OpenCL, Device);
 
+    if(data_.memoryProgram != NULL){
+      clReleaseKernel(data_.gatherKernel);
+      clReleaseKernel(data_.scatterKernel);
+      clReleaseProgram(data_.memoryProgram);
+    }
+
+    std::map<std::string, cl_program>::iterator it = data_.programs.begin();
+
+    while(it != data_.programs.end()){
+      clReleaseProgram(it->second);
+      ++it;
+    }
+
     OCCA_CL_CHECK("Device: Freeing Context",
                   clReleaseContext(data_.context) );
 
@@ -1038,6 +1366,11 @@ namespace occa {
 
     return simdWidth_;
   }
+
+  template <>
+  void device_t<OpenCL>::runGraph(graph_v &graph){
+    graph.runNodes();
+  }
   //==================================
 
 
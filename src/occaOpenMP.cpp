@@ -1,4 +1,9 @@
 #include "occaOpenMP.hpp"
+#include "occaGraph.hpp"
+
+#if OCCA_OPENMP_ENABLED
+#  include <omp.h>
+#endif
 
 namespace occa {
   //---[ Kernel ]---------------------
@@ -74,10 +79,11 @@ namespace occa {
          << dev->dHandle->compilerEnvScript
          << dev->dHandle->compiler
          << dev->dHandle->compilerFlags
-         << functionName;
+         << getCpuIsa();
 
     struct stat buffer;
-    std::string cachedBinary = getCachedName(filename, salt.str());
+    std::string cachedBinary = getCachedName(filename, salt.str(), "OpenMP",
+                                             dev->dHandle->compilerFlags + ' ' + info.flags);
 
 #if OCCA_OS == WINDOWS_OS
     // Windows refuses to load dll's that do not end with '.dll'
@@ -88,20 +94,42 @@ namespace occa {
 
     if(fileExists){
       std::cout << "Found cached binary of [" << filename << "] in [" << cachedBinary << "]\n";
-      return buildFromBinary(cachedBinary, functionName);
+
+      try {
+        return buildFromBinary(cachedBinary, functionName);
+      }
+      catch(...){
+        // Evicted by a cache prune before it was loaded, build it again
+        if(stat(cachedBinary.c_str(), &buffer) == 0)
+          throw;
+
+        delete (OpenMPKernelData_t*) data;
+        data = NULL;
+      }
     }
 
-    if(!haveFile(cachedBinary)){
-      waitForFile(cachedBinary);
+    // Built by the occa-compile-server, if one is running
+    if(compileServer::build("OpenMP", filename, functionName, info_, cachedBinary))
+      return buildFromBinary(cachedBinary, functionName);
 
+    // Someone else is making it (or failed to, then it's ours to make)
+    if(!haveFile(cachedBinary) && waitForFile(cachedBinary))
       return buildFromBinary(cachedBinary, functionName);
-    }
 
     data = new OpenMPKernelData_t;
 
+    // The occaKeywords prelude is parsed once per compiler setup
+    const std::string preludeHeader = getPrecompiledPrelude(dev->dHandle->compilerEnvScript,
+                                                            dev->dHandle->compiler
+                                                            + " -w -fPIC "
+                                                            + dev->dHandle->compilerFlags
+                                                            + ' ' + info.flags,
+                                                            info.occaKeywords);
+
     std::string iCachedBinary = createIntermediateSource(filename,
                                                          cachedBinary,
-                                                         info);
+                                                         info,
+                                                         preludeHeader);
 
     std::stringstream command;
 
@@ -128,11 +156,9 @@ namespace occa {
 
     std::cout << "Compiling [" << functionName << "]\n" << sCommand << "\n";
 
-#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
-    const int compileError = system(sCommand.c_str());
-#else
-    const int compileError = system(("\"" +  sCommand + "\"").c_str());
-#endif
+    const int compileError = getCompilerBackend().compile(readFile(iCachedBinary),
+                                                          cachedBinary,
+                                                          sCommand);
 
     if(compileError){
       releaseFile(cachedBinary);
@@ -239,6 +265,26 @@ namespace occa {
     return 1.0e3*(end - start);
   }
 
+  template <>
+  bool kernel_t<OpenMP>::dumpProfile(){
+    OCCA_EXTRACT_DATA(OpenMP, Kernel);
+
+    void (*dump)() = NULL;
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    dump = (void (*)()) dlsym(data_.dlHandle, profileDumpName);
+#else
+    dump = (void (*)()) GetProcAddress((HMODULE) (data_.dlHandle), profileDumpName);
+#endif
+
+    if(dump == NULL)
+      return false;
+
+    dump();
+
+    return true;
+  }
+
   template <>
   void kernel_t<OpenMP>::free(){
     // [-] Fix later
@@ -265,6 +311,9 @@ namespace occa {
     handle = m.handle;
     dev    = m.dev;
     size   = m.size;
+
+    mappedPtr   = m.mappedPtr;
+    mappedBytes = m.mappedBytes;
   }
 
   template <>
@@ -273,6 +322,9 @@ namespace occa {
     dev    = m.dev;
     size   = m.size;
 
+    mappedPtr   = m.mappedPtr;
+    mappedBytes = m.mappedBytes;
+
     return *this;
   }
 
@@ -383,9 +435,67 @@ namespace occa {
              bytes_);
   }
 
+  template <>
+  void memory_t<OpenMP>::fill(const void *pattern,
+                              const uintptr_t patternBytes,
+                              const uintptr_t bytes,
+                              const uintptr_t offset){
+    const uintptr_t bytes_ = (bytes == 0) ? size : bytes;
+
+    OCCA_CHECK((bytes_ + offset) <= size);
+
+    char *ptr = ((char*) handle) + offset;
+
+#if OCCA_OPENMP_ENABLED
+#  pragma omp parallel
+    occa::memFill(ptr, pattern, patternBytes, bytes_,
+                  omp_get_thread_num(), omp_get_num_threads());
+#else
+    occa::memFill(ptr, pattern, patternBytes, bytes_);
+#endif
+  }
+
+  template <>
+  void memory_t<OpenMP>::gather(memory_v *dest,
+                                const memory_v *indices,
+                                const uintptr_t entryBytes,
+                                const uintptr_t entries){
+    const int *indices_ = (const int*) indices->handle;
+
+#if OCCA_OPENMP_ENABLED
+#  pragma omp parallel
+    occa::memGather(dest->handle, handle, indices_, entryBytes, entries,
+                    omp_get_thread_num(), omp_get_num_threads());
+#else
+    occa::memGather(dest->handle, handle, indices_, entryBytes, entries);
+#endif
+  }
+
+  template <>
+  void memory_t<OpenMP>::scatter(memory_v *dest,
+                                 const memory_v *indices,
+                                 const uintptr_t entryBytes,
+                                 const uintptr_t entries){
+    const int *indices_ = (const int*) indices->handle;
+
+#if OCCA_OPENMP_ENABLED
+#  pragma omp parallel
+    occa::memScatter(dest->handle, handle, indices_, entryBytes, entries,
+                     omp_get_thread_num(), omp_get_num_threads());
+#else
+    occa::memScatter(dest->handle, handle, indices_, entryBytes, entries);
+#endif
+  }
+
   template <>
   void memory_t<OpenMP>::free(){
-    delete (char*) handle;
+    if(mappedPtr){
+      occa::unmapFile(mappedPtr, mappedBytes);
+      mappedPtr = NULL;
+    }
+    else
+      delete (char*) handle;
+
     size = 0;
   }
   //==================================
@@ -394,24 +504,28 @@ namespace occa {
   //---[ Device ]---------------------
   template <>
   device_t<OpenMP>::device_t(){
-    data            = NULL;
-    memoryAllocated = 0;
+    data                = NULL;
+    memoryAllocated     = 0;
+    hostMemoryAllocated = 0;
 
     getEnvironmentVariables();
   }
 
   template <>
   device_t<OpenMP>::device_t(int platform, int device){
-    data            = NULL;
-    memoryAllocated = 0;
+    data                = NULL;
+    memoryAllocated     = 0;
+    hostMemoryAllocated = 0;
 
     getEnvironmentVariables();
   }
 
   template <>
   device_t<OpenMP>::device_t(const device_t<OpenMP> &d){
-    data            = d.data;
-    memoryAllocated = d.memoryAllocated;
+    data                = d.data;
+    memoryAllocated     = d.memoryAllocated;
+    hostMemoryAllocated = d.hostMemoryAllocated;
+    pinnedBuffers       = d.pinnedBuffers;
 
     compiler      = d.compiler;
     compilerFlags = d.compilerFlags;
@@ -419,8 +533,10 @@ namespace occa {
 
   template <>
   device_t<OpenMP>& device_t<OpenMP>::operator = (const device_t<OpenMP> &d){
-    data            = d.data;
-    memoryAllocated = d.memoryAllocated;
+    data                = d.data;
+    memoryAllocated     = d.memoryAllocated;
+    hostMemoryAllocated = d.hostMemoryAllocated;
+    pinnedBuffers       = d.pinnedBuffers;
 
     compiler      = d.compiler;
     compilerFlags = d.compilerFlags;
@@ -453,13 +569,13 @@ namespace occa {
 #if OCCA_DEBUG_ENABLED
       compilerFlags = "-g";
 #else
-      compilerFlags = "-D__extern_always_inline=inline -O3";
+      compilerFlags = "-D__extern_always_inline=inline -O3 " + getCpuTargetFlags();
 #endif
 #else
 #if OCCA_DEBUG_ENABLED
       compilerFlags = " /Od ";
 #else
-      compilerFlags = " /Ox /openmp ";
+      compilerFlags = " /Ox /openmp " + getCpuTargetFlags();
 #endif
       std::string byteness;
       if(sizeof(void*) == 4)
@@ -578,6 +694,38 @@ namespace occa {
     return mem;
   }
 
+  template <>
+  memory_v* device_t<OpenMP>::mapFile(const std::string &filename,
+                                      const uintptr_t offset,
+                                      const uintptr_t bytes,
+                                      const int flags){
+    memory_v *mem = new memory_t<OpenMP>;
+
+    uintptr_t bytes_ = bytes;
+
+    mem->dev    = dev;
+    mem->handle = occa::mapFile(filename, offset, bytes_, flags,
+                                mem->mappedPtr, mem->mappedBytes);
+    mem->size   = bytes_;
+
+    return mem;
+  }
+
+  template <>
+  pinnedBuffer device_t<OpenMP>::mallocHost(const uintptr_t bytes){
+    pinnedBuffer buffer;
+
+    buffer.ptr   = occa::pinnedAlloc(bytes);
+    buffer.bytes = bytes;
+
+    return buffer;
+  }
+
+  template <>
+  void device_t<OpenMP>::freeHost(pinnedBuffer &buffer){
+    occa::pinnedFree(buffer.ptr, buffer.bytes);
+  }
+
   template <>
   void device_t<OpenMP>::free(){}
 
@@ -586,5 +734,26 @@ namespace occa {
     simdWidth_ = OCCA_SIMD_WIDTH;
     return OCCA_SIMD_WIDTH;
   }
+
+  template <>
+  void device_t<OpenMP>::runGraph(graph_v &graph){
+    graph.runNodes();
+  }
+
+  template <>
+  std::vector<occa::deviceInfo> availableDevices<OpenMP>(){
+    device_t<OpenMP> d;
+
+    std::vector<occa::deviceInfo> ret(1, hostDeviceInfo(OpenMP, d.getCompilerFlags()));
+
+    std::cout << occa::deviceInfo::sLine  << '\n'
+              << occa::deviceInfo::header << '\n'
+              << occa::deviceInfo::sLine  << '\n'
+              << ret[0].summarizedInfo()  << '\n'
+              << occa::deviceInfo::sLine  << '\n'
+              << ret[0].detailedInfo();
+
+    return ret;
+  }
   //==================================
 };
@@ -1,6 +1,7 @@
 #if OCCA_PTHREADS_ENABLED
 
 #include "occaPthreads.hpp"
+#include "occaGraph.hpp"
 
 namespace occa {
   //---[ Kernel ]---------------------
@@ -72,29 +73,52 @@ namespace occa {
          << dev->dHandle->compilerEnvScript
          << dev->dHandle->compiler
          << dev->dHandle->compilerFlags
-         << functionName;
+         << getCpuIsa();
 
-    std::string cachedBinary = getCachedName(filename, salt.str());
+    std::string cachedBinary = getCachedName(filename, salt.str(), "Pthreads",
+                                             dev->dHandle->compilerFlags + ' ' + info.flags);
 
     struct stat buffer;
     bool fileExists = (stat(cachedBinary.c_str(), &buffer) == 0);
 
     if(fileExists){
       std::cout << "Found cached binary of [" << filename << "] in [" << cachedBinary << "]\n";
-      return buildFromBinary(cachedBinary, functionName);
+
+      try {
+        return buildFromBinary(cachedBinary, functionName);
+      }
+      catch(...){
+        // Evicted by a cache prune before it was loaded, build it again
+        if(stat(cachedBinary.c_str(), &buffer) == 0)
+          throw;
+
+        delete (PthreadsKernelData_t*) data;
+        data = NULL;
+      }
     }
 
-    if(!haveFile(cachedBinary)){
-      waitForFile(cachedBinary);
+    // Built by the occa-compile-server, if one is running
+    if(compileServer::build("Pthreads", filename, functionName, info_, cachedBinary))
+      return buildFromBinary(cachedBinary, functionName);
 
+    // Someone else is making it (or failed to, then it's ours to make)
+    if(!haveFile(cachedBinary) && waitForFile(cachedBinary))
       return buildFromBinary(cachedBinary, functionName);
-    }
 
     data = new PthreadsKernelData_t;
 
+    // The occaKeywords prelude is parsed once per compiler setup
+    const std::string preludeHeader = getPrecompiledPrelude(dev->dHandle->compilerEnvScript,
+                                                            dev->dHandle->compiler
+                                                            + " -w -fPIC "
+                                                            + dev->dHandle->compilerFlags
+                                                            + ' ' + info.flags,
+                                                            info.occaKeywords);
+
     std::string iCachedBinary = createIntermediateSource(filename,
                                                          cachedBinary,
-                                                         info);
+                                                         info,
+                                                         preludeHeader);
 
     std::stringstream command;
 
@@ -121,7 +145,9 @@ namespace occa {
 
     std::cout << "Compiling [" << functionName << "]\n" << sCommand << "\n";
 
-    const int compileError = system(sCommand.c_str());
+    const int compileError = getCompilerBackend().compile(readFile(iCachedBinary),
+                                                          cachedBinary,
+                                                          sCommand);
 
     if(compileError){
       releaseFile(cachedBinary);
@@ -218,6 +244,20 @@ namespace occa {
     return 1.0e3*(end - start);
   }
 
+  template <>
+  bool kernel_t<Pthreads>::dumpProfile(){
+    OCCA_EXTRACT_DATA(Pthreads, Kernel);
+
+    void (*dump)() = (void (*)()) dlsym(data_.dlHandle, profileDumpName);
+
+    if(dump == NULL)
+      return false;
+
+    dump();
+
+    return true;
+  }
+
   template <>
   void kernel_t<Pthreads>::free(){
     // [-] Fix later
@@ -228,6 +268,207 @@ namespace occa {
   //==================================
 
 
+  //---[ Memory Jobs ]----------------
+  // Memory operations go through the worker queues to stay ordered
+  //   with the kernels that were launched before them
+  static void pthreadsQueueJob(PthreadsDeviceData_t &dData,
+                               PthreadLaunchHandle_t job,
+                               const kernelArg *jobArgs,
+                               const int jobArgCount,
+                               const uintptr_t privateBytes = 0){
+    const int pThreadCount = dData.pThreadCount;
+
+    for(int p = 0; p < pThreadCount; ++p){
+      PthreadKernelArg_t *args = new PthreadKernelArg_t;
+      args->rank  = p;
+      args->count = pThreadCount;
+
+      args->kernelHandle = NULL;
+
+      for(int i = 0; i < jobArgCount; ++i)
+        args->args[i] = jobArgs[i];
+
+      // Each worker gets its own copy of args[1], freed by the job
+      if(privateBytes){
+        char *buffer = new char[privateBytes];
+        ::memcpy(buffer, jobArgs[1].arg.void_, privateBytes);
+
+        args->args[1].arg.void_ = buffer;
+      }
+
+      pthread_mutex_lock(&(dData.kernelMutex));
+      dData.kernelLaunch[p].push(job);
+      dData.kernelArgs[p].push(args);
+      pthread_mutex_unlock(&(dData.kernelMutex));
+    }
+
+    pthread_mutex_lock(&(dData.pendingJobsMutex));
+    dData.pendingJobs += pThreadCount;
+    pthread_mutex_unlock(&(dData.pendingJobsMutex));
+  }
+
+  static void pthreadsFillJob(PthreadKernelArg_t &args){
+    occa::memFill(args.args[0].arg.void_,
+                  args.args[1].arg.void_,
+                  args.args[2].arg.uintptr_t_,
+                  args.args[3].arg.uintptr_t_,
+                  args.rank, args.count);
+
+    delete [] (char*) args.args[1].arg.void_;
+  }
+
+  static void pthreadsGatherJob(PthreadKernelArg_t &args){
+    occa::memGather(args.args[0].arg.void_,
+                    args.args[1].arg.void_,
+                    (const int*) args.args[2].arg.void_,
+                    args.args[3].arg.uintptr_t_,
+                    args.args[4].arg.uintptr_t_,
+                    args.rank, args.count);
+  }
+
+  static void pthreadsScatterJob(PthreadKernelArg_t &args){
+    occa::memScatter(args.args[0].arg.void_,
+                     args.args[1].arg.void_,
+                     (const int*) args.args[2].arg.void_,
+                     args.args[3].arg.uintptr_t_,
+                     args.args[4].arg.uintptr_t_,
+                     args.rank, args.count);
+  }
+  //==================================
+
+
+  //---[ Kernel Graphs ]--------------
+  static const PthreadLaunchHandle_t pthreadsLaunchKernels[50] = {
+    launchKernel1 , launchKernel2 , launchKernel3 , launchKernel4 , launchKernel5 ,
+    launchKernel6 , launchKernel7 , launchKernel8 , launchKernel9 , launchKernel10,
+    launchKernel11, launchKernel12, launchKernel13, launchKernel14, launchKernel15,
+    launchKernel16, launchKernel17, launchKernel18, launchKernel19, launchKernel20,
+    launchKernel21, launchKernel22, launchKernel23, launchKernel24, launchKernel25,
+    launchKernel26, launchKernel27, launchKernel28, launchKernel29, launchKernel30,
+    launchKernel31, launchKernel32, launchKernel33, launchKernel34, launchKernel35,
+    launchKernel36, launchKernel37, launchKernel38, launchKernel39, launchKernel40,
+    launchKernel41, launchKernel42, launchKernel43, launchKernel44, launchKernel45,
+    launchKernel46, launchKernel47, launchKernel48, launchKernel49, launchKernel50
+  };
+
+  // Fill, gather or scatter node with its buffers resolved
+  class pthreadsMemoryOp {
+  public:
+    graphNode::nodeType type; // barrier if the node is something else
+
+    char *dest;
+    const char *src;
+    const int *indices;
+
+    std::string pattern;
+    uintptr_t bytes, entryBytes, entries;
+
+    inline pthreadsMemoryOp() :
+      type(graphNode::barrier),
+      dest(NULL),
+      src(NULL),
+      indices(NULL),
+      bytes(0),
+      entryBytes(0),
+      entries(0) {}
+  };
+
+  // A replay is queued as one job, every rank walks through the nodes
+  //   and only waits for the others between nodes that share a buffer
+  class pthreadsGraphPlan : public graphPlan {
+  public:
+    int nodeCount, pThreadCount;
+
+    // Launches (NULL for copies and barriers) and their per-rank arguments
+    std::vector<PthreadLaunchHandle_t> launches;
+    std::vector<PthreadKernelArg_t*> launchArgs;
+
+    std::vector<char*> copyDest;
+    std::vector<const char*> copySrc;
+    std::vector<uintptr_t> copyBytes;
+
+    // Fills, gathers and scatters, split across ranks like their queued jobs
+    std::vector<pthreadsMemoryOp> memoryOps;
+
+    std::vector<char> barrierAfter;
+
+    volatile int arrived, phase;
+
+    inline pthreadsGraphPlan(const int nodeCount_, const int pThreadCount_) :
+      nodeCount(nodeCount_),
+      pThreadCount(pThreadCount_),
+      launches(nodeCount_, (PthreadLaunchHandle_t) NULL),
+      launchArgs(nodeCount_ * pThreadCount_, (PthreadKernelArg_t*) NULL),
+      copyDest(nodeCount_, (char*) NULL),
+      copySrc(nodeCount_, (const char*) NULL),
+      copyBytes(nodeCount_, 0),
+      memoryOps(nodeCount_),
+      barrierAfter(nodeCount_, 0),
+      arrived(0),
+      phase(0) {}
+
+    inline ~pthreadsGraphPlan(){
+      const int argCount = launchArgs.size();
+
+      for(int i = 0; i < argCount; ++i)
+        delete launchArgs[i];
+    }
+
+    inline void barrier(){
+      const int phase_ = phase;
+
+      if(__sync_add_and_fetch(&arrived, 1) == pThreadCount){
+        arrived = 0;
+        __sync_synchronize();
+        phase = phase_ + 1;
+      }
+      else{
+        while(phase == phase_)
+          __asm__ __volatile__ ("lfence");
+      }
+
+      __sync_synchronize();
+    }
+  };
+
+  static void pthreadsGraphMemoryOp(const pthreadsMemoryOp &op,
+                                    const int rank, const int count){
+    if(op.type == graphNode::fill)
+      occa::memFill(op.dest, op.pattern.c_str(), op.pattern.size(), op.bytes, rank, count);
+    else if(op.type == graphNode::gather)
+      occa::memGather(op.dest, op.src, op.indices, op.entryBytes, op.entries, rank, count);
+    else
+      occa::memScatter(op.dest, op.src, op.indices, op.entryBytes, op.entries, rank, count);
+  }
+
+  static void pthreadsGraphJob(PthreadKernelArg_t &args){
+    pthreadsGraphPlan &plan = *((pthreadsGraphPlan*) args.args[0].arg.void_);
+
+    const int rank  = args.rank;
+    const int count = args.count;
+
+    for(int n = 0; n < plan.nodeCount; ++n){
+      if(plan.launches[n] != NULL)
+        plan.launches[n]( *(plan.launchArgs[n*count + rank]) );
+      else if(plan.copyDest[n] != NULL){
+        const uintptr_t bytes = plan.copyBytes[n];
+        const uintptr_t chunk = (bytes + count - 1) / count;
+        const uintptr_t start = std::min(bytes, rank * chunk);
+        const uintptr_t end   = std::min(bytes, start + chunk);
+
+        if(start < end)
+          ::memcpy(plan.copyDest[n] + start, plan.copySrc[n] + start, end - start);
+      }
+      else if(plan.memoryOps[n].type != graphNode::barrier)
+        pthreadsGraphMemoryOp(plan.memoryOps[n], rank, count);
+
+      if(plan.barrierAfter[n])
+        plan.barrier();
+    }
+  }
+  //==================================
+
+
   //---[ Memory ]---------------------
   template <>
   memory_t<Pthreads>::memory_t(){
@@ -241,6 +482,9 @@ namespace occa {
     handle = m.handle;
     dev    = m.dev;
     size   = m.size;
+
+    mappedPtr   = m.mappedPtr;
+    mappedBytes = m.mappedBytes;
   }
 
   template <>
@@ -249,6 +493,9 @@ namespace occa {
     dev    = m.dev;
     size   = m.size;
 
+    mappedPtr   = m.mappedPtr;
+    mappedBytes = m.mappedBytes;
+
     return *this;
   }
 
@@ -367,9 +614,69 @@ namespace occa {
              bytes_);
   }
 
+  template <>
+  void memory_t<Pthreads>::fill(const void *pattern,
+                                const uintptr_t patternBytes,
+                                const uintptr_t bytes,
+                                const uintptr_t offset){
+    const uintptr_t bytes_ = (bytes == 0) ? size : bytes;
+
+    OCCA_CHECK((bytes_ + offset) <= size);
+
+    PthreadsDeviceData_t &dData = *((PthreadsDeviceData_t*) dev->dHandle->data);
+
+    kernelArg jobArgs[4];
+    jobArgs[0] = kernelArg((void*) (((char*) handle) + offset));
+    jobArgs[1] = kernelArg((void*) pattern);
+    jobArgs[2] = kernelArg(patternBytes);
+    jobArgs[3] = kernelArg(bytes_);
+
+    pthreadsQueueJob(dData, pthreadsFillJob, jobArgs, 4, patternBytes);
+  }
+
+  template <>
+  void memory_t<Pthreads>::gather(memory_v *dest,
+                                  const memory_v *indices,
+                                  const uintptr_t entryBytes,
+                                  const uintptr_t entries){
+    PthreadsDeviceData_t &dData = *((PthreadsDeviceData_t*) dev->dHandle->data);
+
+    kernelArg jobArgs[5];
+    jobArgs[0] = kernelArg(dest->handle);
+    jobArgs[1] = kernelArg(handle);
+    jobArgs[2] = kernelArg(indices->handle);
+    jobArgs[3] = kernelArg(entryBytes);
+    jobArgs[4] = kernelArg(entries);
+
+    pthreadsQueueJob(dData, pthreadsGatherJob, jobArgs, 5);
+  }
+
+  template <>
+  void memory_t<Pthreads>::scatter(memory_v *dest,
+                                   const memory_v *indices,
+                                   const uintptr_t entryBytes,
+                                   const uintptr_t entries){
+    PthreadsDeviceData_t &dData = *((PthreadsDeviceData_t*) dev->dHandle->data);
+
+    kernelArg jobArgs[5];
+    jobArgs[0] = kernelArg(dest->handle);
+    jobArgs[1] = kernelArg(handle);
+    jobArgs[2] = kernelArg(indices->handle);
+    jobArgs[3] = kernelArg(entryBytes);
+    jobArgs[4] = kernelArg(entries);
+
+    pthreadsQueueJob(dData, pthreadsScatterJob, jobArgs, 5);
+  }
+
   template <>
   void memory_t<Pthreads>::free(){
-    delete (char*) handle;
+    if(mappedPtr){
+      occa::unmapFile(mappedPtr, mappedBytes);
+      mappedPtr = NULL;
+    }
+    else
+      delete (char*) handle;
+
     size = 0;
   }
   //==================================
@@ -378,24 +685,28 @@ namespace occa {
   //---[ Device ]---------------------
   template <>
   device_t<Pthreads>::device_t(){
-    data            = NULL;
-    memoryAllocated = 0;
+    data                = NULL;
+    memoryAllocated     = 0;
+    hostMemoryAllocated = 0;
 
     getEnvironmentVariables();
   }
 
   template <>
   device_t<Pthreads>::device_t(int platform, int device){
-    data            = NULL;
-    memoryAllocated = 0;
+    data                = NULL;
+    memoryAllocated     = 0;
+    hostMemoryAllocated = 0;
 
     getEnvironmentVariables();
   }
 
   template <>
   device_t<Pthreads>::device_t(const device_t<Pthreads> &d){
-    data            = d.data;
-    memoryAllocated = d.memoryAllocated;
+    data                = d.data;
+    memoryAllocated     = d.memoryAllocated;
+    hostMemoryAllocated = d.hostMemoryAllocated;
+    pinnedBuffers       = d.pinnedBuffers;
 
     compiler      = d.compiler;
     compilerFlags = d.compilerFlags;
@@ -403,8 +714,10 @@ namespace occa {
 
   template <>
   device_t<Pthreads>& device_t<Pthreads>::operator = (const device_t<Pthreads> &d){
-    data            = d.data;
-    memoryAllocated = d.memoryAllocated;
+    data                = d.data;
+    memoryAllocated     = d.memoryAllocated;
+    hostMemoryAllocated = d.hostMemoryAllocated;
+    pinnedBuffers       = d.pinnedBuffers;
 
     compiler      = d.compiler;
     compilerFlags = d.compilerFlags;
@@ -418,7 +731,8 @@ namespace occa {
 
     OCCA_EXTRACT_DATA(Pthreads, Device);
 
-    data_.pendingJobs = 0;
+    data_.pendingJobs  = 0;
+    data_.finishedJobs = 0;
 
 #if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
     data_.coreCount = sysconf(_SC_NPROCESSORS_ONLN);
@@ -447,7 +761,8 @@ namespace occa {
       else
         args->pinnedCore = p % data_.coreCount;
 
-      args->pendingJobs = &(data_.pendingJobs);
+      args->pendingJobs  = &(data_.pendingJobs);
+      args->finishedJobs = &(data_.finishedJobs);
 
       args->pendingJobsMutex = &(data_.pendingJobsMutex);
       args->kernelMutex      = &(data_.kernelMutex);
@@ -480,7 +795,7 @@ namespace occa {
 #if OCCA_DEBUG_ENABLED
       compilerFlags = "-g";
 #else
-      compilerFlags = "-D__extern_always_inline=inline -O3";
+      compilerFlags = "-D__extern_always_inline=inline -O3 " + getCpuTargetFlags();
 #endif
     }
   }
@@ -590,6 +905,38 @@ namespace occa {
     return mem;
   }
 
+  template <>
+  memory_v* device_t<Pthreads>::mapFile(const std::string &filename,
+                                        const uintptr_t offset,
+                                        const uintptr_t bytes,
+                                        const int flags){
+    memory_v *mem = new memory_t<Pthreads>;
+
+    uintptr_t bytes_ = bytes;
+
+    mem->dev    = dev;
+    mem->handle = occa::mapFile(filename, offset, bytes_, flags,
+                                mem->mappedPtr, mem->mappedBytes);
+    mem->size   = bytes_;
+
+    return mem;
+  }
+
+  template <>
+  pinnedBuffer device_t<Pthreads>::mallocHost(const uintptr_t bytes){
+    pinnedBuffer buffer;
+
+    buffer.ptr   = occa::pinnedAlloc(bytes);
+    buffer.bytes = bytes;
+
+    return buffer;
+  }
+
+  template <>
+  void device_t<Pthreads>::freeHost(pinnedBuffer &buffer){
+    occa::pinnedFree(buffer.ptr, buffer.bytes);
+  }
+
   template <>
   void device_t<Pthreads>::free(){
     finish();
@@ -607,6 +954,177 @@ namespace occa {
     simdWidth_ = OCCA_SIMD_WIDTH;
     return OCCA_SIMD_WIDTH;
   }
+
+  template <>
+  void device_t<Pthreads>::runGraph(graph_v &graph){
+    OCCA_EXTRACT_DATA(Pthreads, Device);
+
+    std::vector<graphNode> &nodes = graph.nodes;
+
+    const int nodeCount    = nodes.size();
+    const int pThreadCount = data_.pThreadCount;
+
+    if(nodeCount == 0)
+      return;
+
+    pthreadsGraphPlan *plan = (pthreadsGraphPlan*) graph.plan;
+
+    // Kernels can be rebuilt between replays
+    for(int n = 0; (plan != NULL) && (n < nodeCount); ++n){
+      if((plan->launches[n] != NULL) &&
+         (plan->launchArgs[n*pThreadCount]->kernelHandle !=
+          ((PthreadsKernelData_t*) nodes[n].kHandle->data)->handle)){
+
+        graph.dropPlan();
+        plan = NULL;
+      }
+    }
+
+    if(plan == NULL){
+      plan = new pthreadsGraphPlan(nodeCount, pThreadCount);
+
+      // Byte ranges touched since the last barrier
+      std::vector< std::pair<const char*, const char*> > used, uses;
+      bool usedUnknown = false;
+
+      for(int n = 0; n < nodeCount; ++n){
+        graphNode &node = nodes[n];
+
+        bool wait    = usedUnknown;
+        bool unknown = false;
+
+        uses.clear();
+
+        if(node.type == graphNode::launch){
+          OCCA_CHECK((0 < node.argCount) && (node.argCount <= 50));
+
+          PthreadsKernelData_t &kData = *((PthreadsKernelData_t*) node.kHandle->data);
+
+          plan->launches[n] = pthreadsLaunchKernels[node.argCount - 1];
+
+          for(int p = 0; p < pThreadCount; ++p){
+            PthreadKernelArg_t *args = new PthreadKernelArg_t;
+            args->rank  = p;
+            args->count = pThreadCount;
+
+            args->kernelHandle = kData.handle;
+
+            args->dims  = node.dims;
+            args->inner = node.inner;
+            args->outer = node.outer;
+
+            for(int i = 0; i < node.argCount; ++i)
+              args->args[i] = node.args[i];
+
+            plan->launchArgs[n*pThreadCount + p] = args;
+          }
+
+          for(int i = 0; i < node.argCount; ++i){
+            const kernelArg &arg = node.args[i];
+
+            if(arg.mHandle != NULL){
+              const char *ptr = (const char*) arg.mHandle->handle;
+              uses.push_back(std::make_pair(ptr, ptr + arg.mHandle->size));
+            }
+            else if(arg.pointer)
+              unknown = true;
+          }
+        }
+        else if(node.type == graphNode::copy){
+          char *dest = ((node.destMem != NULL)
+                        ? ((char*) node.destMem->handle) + node.destOffset
+                        : (char*) node.destPtr);
+
+          const char *src = ((node.srcMem != NULL)
+                             ? ((const char*) node.srcMem->handle) + node.srcOffset
+                             : (const char*) node.srcPtr);
+
+          plan->copyDest[n]  = dest;
+          plan->copySrc[n]   = src;
+          plan->copyBytes[n] = node.bytes;
+
+          uses.push_back(std::make_pair((const char*) dest, (const char*) dest + node.bytes));
+          uses.push_back(std::make_pair(src, src + node.bytes));
+        }
+        else if(node.type != graphNode::barrier){
+          pthreadsMemoryOp &op = plan->memoryOps[n];
+
+          op.type = node.type;
+
+          if(node.type == graphNode::fill){
+            op.dest    = ((char*) node.destMem->handle) + node.destOffset;
+            op.pattern = node.pattern;
+            op.bytes   = node.bytes;
+
+            uses.push_back(std::make_pair((const char*) op.dest, (const char*) op.dest + op.bytes));
+          }
+          else{
+            op.dest       = (char*) node.destMem->handle;
+            op.src        = (const char*) node.srcMem->handle;
+            op.indices    = (const int*) node.indicesMem->handle;
+            op.entryBytes = node.entryBytes;
+            op.entries    = node.entries;
+
+            // Gathers write the front of dest, scatters read the front of src
+            const uintptr_t packedBytes = node.entries * node.entryBytes;
+
+            const uintptr_t destBytes = ((node.type == graphNode::gather)
+                                         ? packedBytes : node.destMem->size);
+            const uintptr_t srcBytes  = ((node.type == graphNode::scatter)
+                                         ? packedBytes : node.srcMem->size);
+
+            const char *indices = (const char*) op.indices;
+
+            uses.push_back(std::make_pair((const char*) op.dest, (const char*) op.dest + destBytes));
+            uses.push_back(std::make_pair(op.src, op.src + srcBytes));
+            uses.push_back(std::make_pair(indices, indices + node.entries*sizeof(int)));
+          }
+        }
+        else
+          wait = true;
+
+        // Raw pointers could point anywhere
+        wait = (wait || unknown);
+
+        for(int u = 0; !wait && (u < (int) uses.size()); ++u){
+          for(int v = 0; !wait && (v < (int) used.size()); ++v)
+            wait = ((uses[u].first < used[v].second) && (used[v].first < uses[u].second));
+        }
+
+        if(wait){
+          if(n)
+            plan->barrierAfter[n - 1] = 1;
+
+          used.clear();
+        }
+
+        used.insert(used.end(), uses.begin(), uses.end());
+        usedUnknown = unknown;
+      }
+
+      graph.plan = plan;
+    }
+
+    const kernelArg jobArgs[] = {kernelArg((void*) plan)};
+
+    pthreadsQueueJob(data_, pthreadsGraphJob, jobArgs, 1);
+  }
+
+  template <>
+  std::vector<occa::deviceInfo> availableDevices<Pthreads>(){
+    device_t<Pthreads> d;
+
+    std::vector<occa::deviceInfo> ret(1, hostDeviceInfo(Pthreads, d.getCompilerFlags()));
+
+    std::cout << occa::deviceInfo::sLine  << '\n'
+              << occa::deviceInfo::header << '\n'
+              << occa::deviceInfo::sLine  << '\n'
+              << ret[0].summarizedInfo()  << '\n'
+              << occa::deviceInfo::sLine  << '\n'
+              << ret[0].detailedInfo();
+
+    return ret;
+  }
   //==================================
 
 #include "operators/occaPthreadsKernelOperators.cpp"
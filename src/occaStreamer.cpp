@@ -0,0 +1,301 @@
+#include "occaStreamer.hpp"
+
+namespace occa {
+  //---[ Streamer ]-------------------
+  streamer::streamer(occa::device &dev_,
+                     occa::kernel &ker_,
+                     const uintptr_t budgetBytes_,
+                     const int buffers_) :
+    dev(&dev_),
+    ker(ker_),
+    budgetBytes(budgetBytes_),
+    buffers(buffers_),
+    innerDim(0),
+    slotEntries(0),
+    chunkEntries_(0) {
+
+    OCCA_CHECK(0 < buffers);
+
+    zeroCopy = (strToMode(dev->mode()) & (Pthreads | OpenMP));
+  }
+
+  void streamer::setInnerDim(const int innerDim_){
+    innerDim = innerDim_;
+  }
+
+  void streamer::disableZeroCopy(){
+    zeroCopy = false;
+  }
+
+  void streamer::addStreamedArg(const int type,
+                                void *ptr,
+                                const uintptr_t entryBytes){
+    streamerArg sArg;
+
+    sArg.type       = type;
+    sArg.ptr        = (char*) ptr;
+    sArg.entryBytes = entryBytes;
+
+    args.push_back(sArg);
+  }
+
+  void streamer::addChunkEntriesArg(){
+    addStreamedArg(entriesArg, NULL, 0);
+  }
+
+  void streamer::addChunkOffsetArg(){
+    addStreamedArg(offsetArg, NULL, 0);
+  }
+
+  void streamer::addInput(const void *src,
+                          const uintptr_t entryBytes){
+    addStreamedArg(inputArg, (void*) src, entryBytes);
+  }
+
+  void streamer::addOutput(void *dest,
+                           const uintptr_t entryBytes){
+    addStreamedArg(outputArg, dest, entryBytes);
+  }
+
+  void streamer::addInOut(void *ptr,
+                          const uintptr_t entryBytes){
+    addStreamedArg(inOutArg, ptr, entryBytes);
+  }
+
+  void streamer::addArgument(const kernelArg &arg){
+    streamerArg sArg;
+
+    sArg.type       = fixedArg;
+    sArg.ptr        = NULL;
+    sArg.entryBytes = 0;
+    sArg.arg        = arg;
+
+    args.push_back(sArg);
+  }
+
+  void streamer::launchChunk(const int slot,
+                             const uintptr_t offset,
+                             const uintptr_t entries){
+    const int inner = innerDim ? innerDim : ker.preferredDimSize();
+
+    ker.setWorkingDims(1, inner, (entries + inner - 1) / inner);
+
+    ker.clearArgumentList();
+
+    const int argCount = args.size();
+    int streamed = 0;
+
+    for(int i = 0; i < argCount; ++i){
+      streamerArg &sArg = args[i];
+
+      switch(sArg.type){
+      case fixedArg:
+        ker.addArgument(i, sArg.arg); break;
+
+      case entriesArg:
+        ker.addArgument(i, kernelArg((int) entries)); break;
+
+      case offsetArg:
+        ker.addArgument(i, kernelArg((int) offset)); break;
+
+      default:
+        if(zeroCopy)
+          ker.addArgument(i, kernelArg((void*) (sArg.ptr + offset*sArg.entryBytes)));
+        else
+          ker.addArgument(i, kernelArg(slotMemory[slot][streamed]));
+
+        ++streamed;
+      }
+    }
+
+    ker.runFromArguments();
+  }
+
+  void streamer::allocateSlots(const int slots,
+                                const uintptr_t chunk){
+    const int argCount = args.size();
+
+    int streamedArgs = 0;
+
+    for(int i = 0; i < argCount; ++i){
+      if(args[i].entryBytes)
+        ++streamedArgs;
+    }
+
+    bool fits = ((slots <= (int) slotMemory.size()) && (chunk <= slotEntries));
+
+    for(int slot = 0; fits && (slot < (int) slotMemory.size()); ++slot)
+      fits = ((int) slotMemory[slot].size() == streamedArgs);
+
+    if(fits)
+      return;
+
+    for(size_t slot = 0; slot < slotMemory.size(); ++slot){
+      for(size_t i = 0; i < slotMemory[slot].size(); ++i)
+        slotMemory[slot][i].free();
+    }
+
+    slotMemory.clear();
+    slotMemory.resize(slots);
+
+    slotEntries = chunk;
+
+    for(int slot = 0; slot < slots; ++slot){
+      for(int i = 0; i < argCount; ++i){
+        if(args[i].entryBytes)
+          slotMemory[slot].push_back( dev->malloc(chunk * args[i].entryBytes) );
+      }
+    }
+  }
+
+  void streamer::downloadChunk(const int slot,
+                               const uintptr_t offset,
+                               const uintptr_t entries){
+    const int argCount = args.size();
+    int streamed = 0;
+
+    for(int i = 0; i < argCount; ++i){
+      streamerArg &sArg = args[i];
+
+      if(sArg.entryBytes == 0)
+        continue;
+
+      if((sArg.type == outputArg) || (sArg.type == inOutArg))
+        slotMemory[slot][streamed].asyncCopyTo(sArg.ptr + offset*sArg.entryBytes,
+                                               entries * sArg.entryBytes);
+      ++streamed;
+    }
+  }
+
+  void streamer::run(const uintptr_t entries){
+    if(entries == 0)
+      return;
+
+    const int argCount = args.size();
+
+    uintptr_t streamedBytes = 0;
+
+    for(int i = 0; i < argCount; ++i)
+      streamedBytes += args[i].entryBytes;
+
+    OCCA_CHECK(0 < streamedBytes);
+
+    const int inner = innerDim ? innerDim : ker.preferredDimSize();
+
+    // Staged chunks keep [buffers] slots resident
+    uintptr_t chunk = budgetBytes / (zeroCopy ? streamedBytes : (buffers * streamedBytes));
+
+    chunk -= (chunk % inner);
+
+    if(chunk == 0){
+      std::cout << "Streamer budget [" << budgetBytes << "] does not fit one work-group of "
+                << inner << " entries.\n";
+      throw 1;
+    }
+
+    if(entries < chunk)
+      chunk = entries;
+
+    OCCA_CHECK(entries <= 2147483647);
+
+    chunkEntries_ = chunk;
+
+    const uintptr_t chunks = (entries + chunk - 1) / chunk;
+    const int slots        = (chunks < (uintptr_t) buffers) ? chunks : buffers;
+
+    // Pthreads and OpenMP copies don't wait for queued kernels
+    const bool orderedCopies = !(strToMode(dev->mode()) & (Pthreads | OpenMP));
+
+    stream originalStream = dev->getStream();
+
+    if(!zeroCopy){
+      while(streams.size() < (size_t) slots)
+        streams.push_back(dev->genStream());
+
+      allocateSlots(slots, chunk);
+
+      // [chunks] marks a slot without pending outputs
+      pendingChunk.assign(slots, chunks);
+    }
+
+    for(uintptr_t c = 0; c < chunks; ++c){
+      const int slot = (c % slots);
+
+      const uintptr_t offset   = (c * chunk);
+      const uintptr_t entries_ = ((offset + chunk) <= entries) ? chunk : (entries - offset);
+
+      if(zeroCopy){
+        launchChunk(slot, offset, entries_);
+        continue;
+      }
+
+      // Host-side copies only wait once a slot comes around again,
+      //   every chunk queued so far is done after the finish
+      if(!orderedCopies && (pendingChunk[slot] < chunks)){
+        dev->finish();
+
+        for(int s = 0; s < slots; ++s){
+          const uintptr_t p = pendingChunk[s];
+
+          if(p < chunks)
+            downloadChunk(s, p*chunk, std::min(chunk, entries - p*chunk));
+
+          pendingChunk[s] = chunks;
+        }
+      }
+
+      // Work on a slot's stream stays ordered behind its previous chunk
+      dev->setStream(streams[slot]);
+
+      int streamed = 0;
+
+      for(int i = 0; i < argCount; ++i){
+        streamerArg &sArg = args[i];
+
+        if(sArg.entryBytes == 0)
+          continue;
+
+        if((sArg.type == inputArg) || (sArg.type == inOutArg))
+          slotMemory[slot][streamed].asyncCopyFrom(sArg.ptr + offset*sArg.entryBytes,
+                                                   entries_ * sArg.entryBytes);
+        ++streamed;
+      }
+
+      launchChunk(slot, offset, entries_);
+
+      if(orderedCopies)
+        downloadChunk(slot, offset, entries_);
+      else
+        pendingChunk[slot] = c;
+    }
+
+    if(zeroCopy)
+      dev->finish();
+    else{
+      for(int slot = 0; slot < slots; ++slot){
+        dev->setStream(streams[slot]);
+        dev->finish();
+      }
+
+      for(int slot = 0; slot < slots; ++slot){
+        const uintptr_t p = pendingChunk[slot];
+
+        if(p < chunks)
+          downloadChunk(slot, p*chunk, std::min(chunk, entries - p*chunk));
+      }
+
+      dev->setStream(originalStream);
+    }
+  }
+
+  void streamer::free(){
+    for(size_t slot = 0; slot < slotMemory.size(); ++slot){
+      for(size_t i = 0; i < slotMemory[slot].size(); ++i)
+        slotMemory[slot][i].free();
+    }
+
+    slotMemory.clear();
+    slotEntries = 0;
+  }
+  //==================================
+};
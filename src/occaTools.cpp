@@ -1,5 +1,33 @@
 #include "occaTools.hpp"
 #include "occa.hpp"      // For kernelInfo
+#include "occaCache.hpp"
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+#  include <sys/mman.h>
+#  include <signal.h>
+#  include <time.h>
+#  include <pthread.h>
+#endif
+
+#if OCCA_OS == LINUX_OS
+#  include <sys/inotify.h>
+#  include <poll.h>
+#endif
+
+#if OCCA_OS == OSX_OS
+#  include <sys/sysctl.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#  define OCCA_X86_CPU 1
+#  if OCCA_OS == WINDOWS_OS
+#    include <intrin.h>
+#  else
+#    include <cpuid.h>
+#  endif
+#else
+#  define OCCA_X86_CPU 0
+#endif
 
 namespace occa {
 
@@ -53,6 +81,22 @@ namespace occa {
     filename = fullFilename.substr(lastSlash, chars - lastSlash);
   }
 
+  std::string getCanonicalPath(const std::string &filename){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    char *c_path = realpath(filename.c_str(), NULL);
+#else
+    char *c_path = _fullpath(NULL, filename.c_str(), 0);
+#endif
+
+    if(c_path == NULL)
+      return filename;
+
+    std::string path(c_path);
+    ::free(c_path);
+
+    return path;
+  }
+
   std::string getFileLock(const std::string &filename){
     std::string prefix, name;
     getFilePrefixAndName(filename, prefix, name);
@@ -60,6 +104,113 @@ namespace occa {
     return (prefix + "._occa_dir_" + name);
   }
 
+  // Called by releaseFile
+  static void writeDependencyManifest(const std::string &filename);
+
+  //---[ File Locks ]-----------------
+  // Locks are directories holding an [owner] file with the owner's host and pid
+  //   Waiters break locks whose owner died (same host) or that outlived
+  //   OCCA_LOCK_TIMEOUT seconds (other hosts, defaults to 600)
+  static const double ownerlessLockSeconds = 30;
+
+  static std::string getHostName(){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    char host[256];
+
+    if(gethostname(host, sizeof(host)) != 0)
+      return "unknown";
+
+    host[sizeof(host) - 1] = '\0';
+
+    return std::string(host);
+#else
+    char *c_host = getenv("COMPUTERNAME");
+
+    return ((c_host != NULL) ? std::string(c_host) : std::string("unknown"));
+#endif
+  }
+
+  static int getProcessID(){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    return (int) getpid();
+#else
+    return (int) GetCurrentProcessId();
+#endif
+  }
+
+  static double lockTimeout(){
+    char *c_timeout = getenv("OCCA_LOCK_TIMEOUT");
+
+    if(c_timeout != NULL){
+      const double timeout = atof(c_timeout);
+
+      if(0 < timeout)
+        return timeout;
+    }
+
+    return 600;
+  }
+
+  // [lockInfo] identifies the lock that was checked
+  static bool lockIsStale(const std::string &lockDir,
+                          struct stat &lockInfo){
+    // Released
+    if(stat(lockDir.c_str(), &lockInfo) != 0)
+      return false;
+
+    const double age = difftime(time(NULL), lockInfo.st_mtime);
+
+    std::ifstream owner((lockDir + "/owner").c_str());
+
+    std::string host;
+    int pid = -1;
+
+    // The owner died between taking the lock and signing it
+    if(!(owner >> host >> pid))
+      return (ownerlessLockSeconds < age);
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    if(host == getHostName())
+      return ((kill(pid, 0) != 0) && (errno == ESRCH));
+#endif
+
+    return (lockTimeout() < age);
+  }
+
+  // The lock is moved aside before it is checked again, a lock released and
+  //   retaken since [staleInfo] was read is put back instead of removed
+  static void breakLock(const std::string &lockDir,
+                        const struct stat &staleInfo){
+    std::stringstream staleDir;
+
+    staleDir << lockDir << ".stale." << getHostName() << '.' << getProcessID();
+
+    // Only one waiter wins the rename
+    if(rename(lockDir.c_str(), staleDir.str().c_str()) != 0)
+      return;
+
+    struct stat lockInfo;
+
+    const bool sameLock = (lockIsStale(staleDir.str(), lockInfo) &&
+                           (lockInfo.st_dev == staleInfo.st_dev) &&
+                           (lockInfo.st_ino == staleInfo.st_ino));
+
+    if(!sameLock){
+      rename(staleDir.str().c_str(), lockDir.c_str());
+      return;
+    }
+
+    std::cout << "Removing stale lock [" << lockDir << "]\n";
+
+    remove((staleDir.str() + "/owner").c_str());
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    rmdir(staleDir.str().c_str());
+#else
+    RemoveDirectoryA(staleDir.str().c_str());
+#endif
+  }
+
   bool haveFile(const std::string &filename){
     std::string lockDir = getFileLock(filename);
 #if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
@@ -68,8 +219,6 @@ namespace occa {
     // Someone else is making it
     if(mkdirStatus && (errno == EEXIST))
       return false;
-
-    return true;
 #else
     LPCSTR lockDirStr = lockDir.c_str();
     BOOL mkdirStatus = CreateDirectoryA(lockDirStr, NULL);
@@ -78,22 +227,99 @@ namespace occa {
       assert(GetLastError() == ERROR_ALREADY_EXISTS);
       return false;
     }
-    return true;
 #endif
+
+    std::ofstream owner((lockDir + "/owner").c_str());
+    owner << getHostName() << ' ' << getProcessID() << '\n';
+
+    return true;
   }
 
-  void waitForFile(const std::string &filename){
+  bool waitForFile(const std::string &filename){
     struct stat buffer;
 
     std::string lockDir   = getFileLock(filename);
     const char *c_lockDir = lockDir.c_str();
 
-    while(stat(c_lockDir, &buffer) == 0)
-      /* Do Nothing */;
+#if OCCA_OS == LINUX_OS
+    // Woken up by changes in the cache directory instead of polling it
+    //   (not delivered across NFS clients, the timeout covers that)
+    std::string prefix, name;
+    getFilePrefixAndName(lockDir, prefix, name);
+
+    int notifyFD = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+    if(0 <= notifyFD){
+      if(inotify_add_watch(notifyFD, (prefix.size() ? prefix.c_str() : "."),
+                           IN_DELETE | IN_MOVED_FROM) < 0){
+        close(notifyFD);
+        notifyFD = -1;
+      }
+    }
+#endif
+
+    double sleepSeconds = 0.001;
+    double nextStaleCheck = currentTime();
+
+    while(stat(c_lockDir, &buffer) == 0){
+      if(nextStaleCheck <= currentTime()){
+        struct stat lockInfo;
+
+        if(lockIsStale(lockDir, lockInfo)){
+          breakLock(lockDir, lockInfo);
+          continue;
+        }
+
+        nextStaleCheck = currentTime() + 1.0;
+      }
+
+#if OCCA_OS == LINUX_OS
+      if(0 <= notifyFD){
+        struct pollfd pfd;
+        pfd.fd     = notifyFD;
+        pfd.events = POLLIN;
+
+        if(0 < poll(&pfd, 1, 1000)){
+          char events[4096];
+          while(0 < read(notifyFD, events, sizeof(events)))
+            /* Drain */;
+        }
+
+        continue;
+      }
+#endif
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+      usleep((useconds_t) (1.0e6 * sleepSeconds));
+#else
+      Sleep((DWORD) (1.0e3 * sleepSeconds));
+#endif
+
+      sleepSeconds = std::min(2*sleepSeconds, 0.25);
+    }
+
+#if OCCA_OS == LINUX_OS
+    if(0 <= notifyFD)
+      close(notifyFD);
+#endif
+
+    if(stat(filename.c_str(), &buffer) == 0)
+      return true;
+
+    // The owner failed, take over unless another waiter did
+    if(haveFile(filename))
+      return false;
+
+    return waitForFile(filename);
   }
 
   void releaseFile(const std::string &filename){
     std::string lockDir = getFileLock(filename);
+
+    writeDependencyManifest(filename);
+    addCacheEntry(filename);
+
+    remove((lockDir + "/owner").c_str());
 #if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
     rmdir(lockDir.c_str());
 #else
@@ -101,170 +327,1826 @@ namespace occa {
     assert(retStatus == TRUE);
 #endif
   }
+  //==================================
 
 
-  std::string fnv(const std::string &saltedString){
-    const int len = saltedString.size();
-    std::stringstream ss;
+  //---[ Dependency Manifests ]-------
+  // Manifests found by getCachedName, written by releaseFile once the binary is built
+  static std::map<std::string, std::string> pendingManifests;
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+  static pthread_mutex_t pendingManifestMutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+  static void setPendingManifest(const std::string &cachedBinary,
+                                 const std::string &manifest){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    pthread_mutex_lock(&pendingManifestMutex);
+#endif
+
+    pendingManifests[cachedBinary] = manifest;
 
-    int h[8] = {101527, 101531,
-                101533, 101537,
-                101561, 101573,
-                101581, 101599};
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    pthread_mutex_unlock(&pendingManifestMutex);
+#endif
+  }
 
-    const int p[8] = {102679, 102701,
-                      102761, 102763,
-                      102769, 102793,
-                      102797, 102811};
+  // Done while holding the binary's lock, readers see the old manifest or the new one
+  static void writeDependencyManifest(const std::string &filename){
+    std::string cachedBinary = filename;
 
-    for(int c = 0; c < len; ++c)
-      for(int i = 0; i < 8; ++i)
-        h[i] = (h[i] * p[i]) ^ saltedString[c];
+#if OCCA_OS == WINDOWS_OS
+    if((4 < cachedBinary.size()) &&
+       (cachedBinary.compare(cachedBinary.size() - 4, 4, ".dll") == 0)){
+      cachedBinary = cachedBinary.substr(0, cachedBinary.size() - 4);
+    }
+#endif
 
-    // int h2[8];
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    pthread_mutex_lock(&pendingManifestMutex);
+#endif
 
-    // for(int i = 0; i < 8; ++i)
-    //   h2[i] = ((h[0] & (0xFF << (8*i))) << (8*i + 0))
-    //     |     ((h[1] & (0xFF << (8*i))) << (8*i + 1))
-    //     |     ((h[2] & (0xFF << (8*i))) << (8*i + 2))
-    //     |     ((h[3] & (0xFF << (8*i))) << (8*i + 3))
-    //     |     ((h[4] & (0xFF << (8*i))) << (8*i + 4))
-    //     |     ((h[5] & (0xFF << (8*i))) << (8*i + 5))
-    //     |     ((h[6] & (0xFF << (8*i))) << (8*i + 6))
-    //     |     ((h[7] & (0xFF << (8*i))) << (8*i + 7));
+    std::map<std::string, std::string>::iterator it = pendingManifests.find(cachedBinary);
 
-    for(int i = 0; i < 8; ++i)
-      ss <<  std::hex << h[i];
+    const bool pending = (it != pendingManifests.end());
+    std::string manifest;
 
-    return ss.str();
-  }
+    if(pending){
+      manifest = it->second;
+      pendingManifests.erase(it);
+    }
 
-  std::string readFile(const std::string &filename){
-    struct stat fileInfo;
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    pthread_mutex_unlock(&pendingManifestMutex);
+#endif
 
-    int fileHandle = ::open(filename.c_str(), O_RDWR);
-    const int status = fstat(fileHandle, &fileInfo);
+    struct stat buffer;
 
-    const int chars = fileInfo.st_size;
+    // The build failed
+    if(!pending || (stat(filename.c_str(), &buffer) != 0))
+      return;
 
-    if(status != 0)
-      printf("File [%s] gave a bad stat", filename.c_str());
+    const std::string manifestPath = cachedBinary + ".deps";
 
-    char *buffer = (char*) malloc(chars);
-    memset(buffer, '\0', chars);
+    std::stringstream tmpPath;
+    tmpPath << manifestPath << ".tmp." << getHostName() << '.' << getProcessID();
 
-    std::ifstream fs(filename.c_str());
-    if(!fs) {
-      std::cerr << "Unable to read file " << filename;
-      throw 1;
+    std::ofstream fs(tmpPath.str().c_str());
+    fs << manifest;
+    fs.close();
+
+    if(!fs.good() ||
+       (rename(tmpPath.str().c_str(), manifestPath.c_str()) != 0)){
+      remove(tmpPath.str().c_str());
     }
+  }
 
-    fs.read(buffer, chars);
+  void readDependencyManifest(const std::string &cachedBinary,
+                              std::vector<std::string> &deps,
+                              std::vector<std::string> &hashes){
+    std::ifstream fs((cachedBinary + ".deps").c_str());
 
-    std::string contents(buffer, chars);
+    std::string hash, dep;
+
+    while(fs >> hash && std::getline(fs >> std::ws, dep)){
+      hashes.push_back(hash);
+      deps.push_back(dep);
+    }
+  }
+  //==================================
 
-    free(buffer);
 
-    return contents;
+  //---[ Hashing ]--------------------
+  static inline uint64_t rotl64(const uint64_t x, const int r){
+    return (x << r) | (x >> (64 - r));
   }
 
-  std::string getCachedName(const std::string &filename,
-                            const std::string &salt){
-    //---[ Place Somewhere Else ]-----
-    char *c_cachePath = getenv("OCCA_CACHE_DIR");
+  static inline uint64_t fmix64(uint64_t k){
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdULL;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53ULL;
+    k ^= k >> 33;
 
-    std::string occaCachePath;
+    return k;
+  }
 
-    if(c_cachePath == NULL){
-      std::stringstream ss;
-#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
-      char *c_home = getenv("HOME");
-      ss << c_home << "/._occa";
+  static const uint64_t murmurC1 = 0x87c37b91114253d5ULL;
+  static const uint64_t murmurC2 = 0x4cf5ad432745937fULL;
 
-      std::string defaultCacheDir = ss.str();
-      mkdir(defaultCacheDir.c_str(), 0755);
-#else
-      char *c_home = getenv("USERPROFILE");
+  hasher::hasher(const uint64_t seed) :
+    h1(seed),
+    h2(seed),
+    totalBytes(0),
+    tailBytes(0) {}
 
-      ss << c_home << "\\AppData\\Local\\OCCA";
+  void hasher::mixBlock(const unsigned char *block){
+    uint64_t k1, k2;
 
-      std::string defaultCacheDir = ss.str();
-      LPCSTR w_defaultCacheDir = defaultCacheDir.c_str();
-      BOOL mkdirStatus = CreateDirectoryA(w_defaultCacheDir, NULL);
+    ::memcpy(&k1, block    , 8);
+    ::memcpy(&k2, block + 8, 8);
 
-      if(mkdirStatus == FALSE)
-        assert(GetLastError() == ERROR_ALREADY_EXISTS);
+    k1 *= murmurC1; k1 = rotl64(k1, 31); k1 *= murmurC2; h1 ^= k1;
 
-#  if OCCA_64_BIT
-      ss << "\\amd64";  // use different dir's fro 32 and 64 bit
-#  else
-      ss << "\\x86";    // use different dir's fro 32 and 64 bit
-#  endif
+    h1 = rotl64(h1, 27); h1 += h2; h1 = h1*5 + 0x52dce729;
 
-      defaultCacheDir = ss.str();
+    k2 *= murmurC2; k2 = rotl64(k2, 33); k2 *= murmurC1; h2 ^= k2;
 
-      w_defaultCacheDir = defaultCacheDir.c_str();
-      mkdirStatus = CreateDirectoryA(w_defaultCacheDir, NULL);
+    h2 = rotl64(h2, 31); h2 += h1; h2 = h2*5 + 0x38495ab5;
+  }
 
-      if(mkdirStatus == FALSE)
-        assert(GetLastError() == ERROR_ALREADY_EXISTS);
-#endif
-      occaCachePath = defaultCacheDir;
+  void hasher::update(const void *data,
+                      const uintptr_t bytes){
+    const unsigned char *c = (const unsigned char*) data;
+    uintptr_t left = bytes;
+
+    totalBytes += bytes;
+
+    // Finish the block left over from the last update
+    if(tailBytes){
+      const uintptr_t room = 16 - tailBytes;
+      const uintptr_t fill = (room < left) ? room : left;
+
+      ::memcpy(tail + tailBytes, c, fill);
+
+      tailBytes += fill;
+      c         += fill;
+      left      -= fill;
+
+      if(tailBytes < 16)
+        return;
+
+      mixBlock(tail);
+      tailBytes = 0;
     }
-    else
-      occaCachePath = c_cachePath;
 
-    const int chars = occaCachePath.size();
+    for(; 16 <= left; c += 16, left -= 16)
+      mixBlock(c);
 
-    OCCA_CHECK(chars > 0);
+    ::memcpy(tail, c, left);
+    tailBytes = left;
+  }
 
-#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
-    const char slashChar = '/';
-#else
-    const char slashChar = '\\';
-#endif
+  void hasher::update(const std::string &str){
+    update(str.c_str(), str.size());
+  }
 
-    // Take out the pesky //'s
-    int pos = 0;
+  std::string hasher::digest() const {
+    uint64_t h1_ = h1, h2_ = h2;
+    uint64_t k1 = 0, k2 = 0;
+
+    switch(tailBytes){
+    case 15: k2 ^= ((uint64_t) tail[14]) << 48;
+      // fall through
+    case 14: k2 ^= ((uint64_t) tail[13]) << 40;
+      // fall through
+    case 13: k2 ^= ((uint64_t) tail[12]) << 32;
+      // fall through
+    case 12: k2 ^= ((uint64_t) tail[11]) << 24;
+      // fall through
+    case 11: k2 ^= ((uint64_t) tail[10]) << 16;
+      // fall through
+    case 10: k2 ^= ((uint64_t) tail[ 9]) << 8;
+      // fall through
+    case  9: k2 ^= ((uint64_t) tail[ 8]);
+      k2 *= murmurC2; k2 = rotl64(k2, 33); k2 *= murmurC1; h2_ ^= k2;
+      // fall through
+    case  8: k1 ^= ((uint64_t) tail[ 7]) << 56;
+      // fall through
+    case  7: k1 ^= ((uint64_t) tail[ 6]) << 48;
+      // fall through
+    case  6: k1 ^= ((uint64_t) tail[ 5]) << 40;
+      // fall through
+    case  5: k1 ^= ((uint64_t) tail[ 4]) << 32;
+      // fall through
+    case  4: k1 ^= ((uint64_t) tail[ 3]) << 24;
+      // fall through
+    case  3: k1 ^= ((uint64_t) tail[ 2]) << 16;
+      // fall through
+    case  2: k1 ^= ((uint64_t) tail[ 1]) << 8;
+      // fall through
+    case  1: k1 ^= ((uint64_t) tail[ 0]);
+      k1 *= murmurC1; k1 = rotl64(k1, 31); k1 *= murmurC2; h1_ ^= k1;
+    }
 
-    for(int i = 0; i < chars; ++i){
-      if(occaCachePath[i] == slashChar)
-        while(i < (chars - 1) && occaCachePath[i + 1] == slashChar)
-          ++i;
+    h1_ ^= totalBytes;
+    h2_ ^= totalBytes;
 
-      occaCachePath[pos++] = occaCachePath[i];
+    h1_ += h2_;
+    h2_ += h1_;
+
+    h1_ = fmix64(h1_);
+    h2_ = fmix64(h2_);
+
+    h1_ += h2_;
+    h2_ += h1_;
+
+    std::stringstream ss;
+
+    ss << std::hex << std::setfill('0')
+       << std::setw(16) << h1_
+       << std::setw(16) << h2_;
+
+    return ss.str();
+  }
+
+  std::string hashString(const std::string &str){
+    hasher h;
+    h.update(str);
+
+    return h.digest();
+  }
+
+  static void hashFileInto(hasher &h,
+                           const std::string &filename){
+    std::ifstream fs(filename.c_str(), std::ios::in | std::ios::binary);
+
+    if(!fs){
+      std::cerr << "Unable to read file " << filename;
+      throw 1;
     }
 
-    if(occaCachePath[pos - 1] != slashChar){
-      if(pos != chars)
-        occaCachePath[pos] = slashChar;
-      else
-        occaCachePath += slashChar;
+    char buffer[1 << 16];
+
+    while(fs){
+      fs.read(buffer, sizeof(buffer));
+      h.update(buffer, fs.gcount());
     }
-    //================================
+  }
 
-    const std::string fileContents = readFile(filename);
-    const std::string contentsSHA  = fnv(fileContents + salt);
+  std::string hashFile(const std::string &filename){
+    hasher h;
+    hashFileInto(h, filename);
 
-    // Only taking the first 16 characters
-    return occaCachePath + contentsSHA.substr(0, 16);
+    return h.digest();
   }
 
-  std::string createIntermediateSource(const std::string &filename,
-                                       const std::string &cachedBinary,
-                                       const kernelInfo &info){
-    std::string prefix, name;
-    getFilePrefixAndName(cachedBinary, prefix, name);
+  // Characters that continue an identifier, number or literal
+  static inline bool isWordChar(const char c){
+    return (isalnum(c) || (c == '_') || (c == '.') ||
+            (c == '"') || (c == '\'') || (c & 0x80));
+  }
 
-    const std::string iCachedBinary = prefix + "i_" + name;
+  // Whitespace between [a] and [b] can only go if joining them doesn't
+  //   make a different token ("a , b" -> "a,b" but "- -" stays)
+  static bool needsSpace(const char a, const char b){
+    const bool aWord = isWordChar(a);
+    const bool bWord = isWordChar(b);
 
-    std::ofstream fs;
-    fs.open(iCachedBinary.c_str());
+    if(aWord != bWord)
+      return false;
 
-    fs << info.occaKeywords << info.header << readFile(filename);
+    if(aWord)
+      return true;
 
-    fs.close();
+    static const char *joined[] = {
+      "->", "++", "--", "<<", ">>", "<=", ">=", "==", "!=", "&&", "||",
+      "+=", "-=", "*=", "/=", "%=", "&=", "|=", "^=", "::", "##", "//",
+      "/*", "*/", "<:", ":>", "<%", "%>", "%:", ".*", NULL
+    };
 
-    return iCachedBinary;
+    for(int i = 0; joined[i]; ++i){
+      if((joined[i][0] == a) && (joined[i][1] == b))
+        return true;
+    }
+
+    return false;
+  }
+
+  static inline bool isSplice(const char *c, const char *end){
+    if((c[0] != '\\') || (end <= (c + 1)))
+      return false;
+
+    return ((c[1] == '\n') ||
+            ((c[1] == '\r') && ((c + 2) < end) && (c[2] == '\n')));
+  }
+
+  static inline int spliceChars(const char *c){
+    return ((c[1] == '\n') ? 2 : 3);
+  }
+
+  // One pass without lookbehind, about as fast as reading the file
+  std::string normalizeSource(const std::string &source){
+    std::string ret;
+    ret.reserve(source.size());
+
+    const char *c   = source.c_str();
+    const char *end = c + source.size();
+
+    bool lineStart      = true;  // Only whitespace since the last newline
+    bool inDirective    = false;
+    bool pendingSpace   = false;
+    bool pendingNewline = false;
+
+    while(c < end){
+      if(isSplice(c, end)){
+        c += spliceChars(c);
+        continue;
+      }
+
+      const char ch = *c;
+
+      if(ch == '\n'){
+        if(inDirective){
+          inDirective    = false;
+          pendingNewline = true;
+        }
+        else
+          pendingSpace = true;
+
+        lineStart = true;
+        ++c;
+        continue;
+      }
+
+      if(isspace(ch)){
+        pendingSpace = true;
+        ++c;
+        continue;
+      }
+
+      // Comments count as whitespace, the newline ending // stays
+      if((ch == '/') && ((c + 1) < end) && (c[1] == '/')){
+        while((c < end) && (*c != '\n')){
+          if(isSplice(c, end))
+            c += spliceChars(c);
+          else
+            ++c;
+        }
+
+        pendingSpace = true;
+        continue;
+      }
+
+      if((ch == '/') && ((c + 1) < end) && (c[1] == '*')){
+        c += 2;
+
+        while(((c + 1) < end) && !((c[0] == '*') && (c[1] == '/')))
+          ++c;
+
+        c = (((c + 1) < end) ? (c + 2) : end);
+
+        pendingSpace = true;
+        continue;
+      }
+
+      // Preprocessor lines keep their own line and inner spacing
+      if(lineStart && (ch == '#')){
+        inDirective    = true;
+        pendingNewline = true;
+      }
+
+      lineStart = false;
+
+      if(ret.size()){
+        const char last = ret[ret.size() - 1];
+
+        if(pendingNewline){
+          if(last != '\n')
+            ret += '\n';
+        }
+        else if(pendingSpace && (last != '\n') &&
+                (inDirective || needsSpace(last, ch))){
+          ret += ' ';
+        }
+      }
+
+      pendingSpace   = false;
+      pendingNewline = false;
+
+      if((ch == '"') || (ch == '\'')){
+        ret += *(c++);
+
+        while((c < end) && (*c != ch) && (*c != '\n')){
+          if((*c == '\\') && ((c + 1) < end))
+            ret += *(c++);
+
+          ret += *(c++);
+        }
+
+        if((c < end) && (*c == ch))
+          ret += *(c++);
+
+        continue;
+      }
+
+      ret += *(c++);
+    }
+
+    return ret;
+  }
+
+  static bool isCSourceFile(const std::string &filename){
+    static const char *extensions[] = {
+      "occa", "okl", "cl", "cu", "cuh",
+      "c", "cc", "cpp", "cxx", "h", "hh", "hpp", "hxx", "tpp", "inl",
+      NULL
+    };
+
+    const size_t dot = filename.rfind('.');
+
+    if((dot == std::string::npos) ||
+       (filename.find_first_of("/\\", dot) != std::string::npos)){
+      return false;
+    }
+
+    const std::string extension = filename.substr(dot + 1);
+
+    for(int i = 0; extensions[i]; ++i){
+      if(extension == extensions[i])
+        return true;
+    }
+
+    return false;
+  }
+
+  class normalizedHash {
+  public:
+    time_t mtime;
+    long mtimeNanoseconds; // Edits within the same second keep [mtime]
+    off_t bytes;
+    std::string digest;
+  };
+
+  static inline long mtimeNanoseconds(const struct stat &buffer){
+#if (OCCA_OS == OSX_OS)
+    return buffer.st_mtimespec.tv_nsec;
+#elif (OCCA_OS == LINUX_OS)
+    return buffer.st_mtim.tv_nsec;
+#else
+    return 0;
+#endif
+  }
+
+  static std::map<std::string, normalizedHash> normalizedHashes;
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+  static pthread_mutex_t normalizedHashMutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+  std::string hashNormalizedFile(const std::string &filename){
+    // Other files (loo.py, Fortran) can have meaningful whitespace
+    if(!isCSourceFile(filename))
+      return hashFile(filename);
+
+    struct stat buffer;
+
+    if(stat(filename.c_str(), &buffer) != 0){
+      std::cerr << "Unable to read file " << filename;
+      throw 1;
+    }
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    pthread_mutex_lock(&normalizedHashMutex);
+#endif
+
+    std::map<std::string, normalizedHash>::iterator it = normalizedHashes.find(filename);
+
+    const bool cached = ((it != normalizedHashes.end()) &&
+                         (it->second.mtime == buffer.st_mtime) &&
+                         (it->second.mtimeNanoseconds == mtimeNanoseconds(buffer)) &&
+                         (it->second.bytes == buffer.st_size));
+
+    const std::string digest = (cached ? it->second.digest : "");
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    pthread_mutex_unlock(&normalizedHashMutex);
+#endif
+
+    if(cached)
+      return digest;
+
+    normalizedHash entry;
+
+    entry.mtime            = buffer.st_mtime;
+    entry.mtimeNanoseconds = mtimeNanoseconds(buffer);
+    entry.bytes            = buffer.st_size;
+    entry.digest           = hashString(normalizeSource(readFile(filename)));
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    pthread_mutex_lock(&normalizedHashMutex);
+#endif
+
+    normalizedHashes[filename] = entry;
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    pthread_mutex_unlock(&normalizedHashMutex);
+#endif
+
+    return entry.digest;
+  }
+  //==================================
+
+  //---[ Include Closure ]------------
+  static void getIncludeDirs(const std::string &flags,
+                             std::vector<std::string> &dirs){
+    std::stringstream ss(flags);
+    std::string token;
+
+    while(ss >> token){
+      if(token.compare(0, 2, "-I") != 0)
+        continue;
+
+      if(token.size() > 2)
+        dirs.push_back(token.substr(2));
+      else if(ss >> token)
+        dirs.push_back(token);
+    }
+  }
+
+  static bool fileExists(const std::string &filename){
+    struct stat buffer;
+    return ((stat(filename.c_str(), &buffer) == 0) && !S_ISDIR(buffer.st_mode));
+  }
+
+  static std::string resolveInclude(const std::string &name,
+                                    const bool quoted,
+                                    const std::string &sourceDir,
+                                    const std::vector<std::string> &includeDirs){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    if(name[0] == '/')
+      return fileExists(name) ? name : "";
+#endif
+
+    if(quoted && fileExists(sourceDir + name))
+      return sourceDir + name;
+
+    const int dirCount = includeDirs.size();
+
+    for(int i = 0; i < dirCount; ++i){
+      const std::string path = includeDirs[i] + "/" + name;
+
+      if(fileExists(path))
+        return path;
+    }
+
+    return "";
+  }
+
+  static void scanIncludes(const std::string &source,
+                           const std::string &sourceDir,
+                           const std::vector<std::string> &includeDirs,
+                           std::vector<std::string> &deps){
+    const char *c = source.c_str();
+
+    while(*c){
+      // Start of line: [spaces] # [spaces] include [spaces] "name" or <name>
+      while((*c == ' ') || (*c == '\t'))
+        ++c;
+
+      if(*c == '#'){
+        ++c;
+
+        while((*c == ' ') || (*c == '\t'))
+          ++c;
+
+        if(strncmp(c, "include", 7) == 0){
+          c += 7;
+
+          while((*c == ' ') || (*c == '\t'))
+            ++c;
+
+          const char close = (*c == '"') ? '"' : ((*c == '<') ? '>' : '\0');
+
+          if(close){
+            const char *start = ++c;
+
+            while(*c && (*c != close) && (*c != '\n'))
+              ++c;
+
+            const std::string name(start, c - start);
+            const std::string path = resolveInclude(name, close == '"', sourceDir, includeDirs);
+
+            if(path.size()){
+              const std::string canonicalPath = getCanonicalPath(path);
+              bool seen = false;
+
+              for(size_t i = 0; i < deps.size(); ++i)
+                seen = seen || (deps[i] == canonicalPath);
+
+              if(!seen){
+                deps.push_back(canonicalPath);
+
+                std::string prefix, filename;
+                getFilePrefixAndName(canonicalPath, prefix, filename);
+
+                scanIncludes(readFile(canonicalPath), prefix, includeDirs, deps);
+              }
+            }
+          }
+        }
+      }
+
+      while(*c && (*c != '\n'))
+        ++c;
+
+      if(*c)
+        ++c;
+    }
+  }
+
+  void getIncludeClosure(const std::string &source,
+                         const std::string &sourceDir,
+                         const std::string &flags,
+                         std::vector<std::string> &deps){
+    std::vector<std::string> includeDirs;
+    getIncludeDirs(flags, includeDirs);
+
+    scanIncludes(source, sourceDir, includeDirs, deps);
+  }
+
+  void hashIncludeClosure(const std::string &filename,
+                          const std::string &salt,
+                          const std::string &compilerFlags,
+                          std::vector<std::string> &deps,
+                          std::vector<std::string> &hashes){
+    std::string prefix, name;
+    getFilePrefixAndName(getCanonicalPath(filename), prefix, name);
+
+    const std::string includeFlags = compilerFlags + ' ' + salt;
+
+    getIncludeClosure(readFile(filename), prefix, includeFlags, deps);
+    getIncludeClosure(salt, "", includeFlags, deps);
+
+    const int depCount = deps.size();
+
+    for(int i = 0; i < depCount; ++i)
+      hashes.push_back( hashNormalizedFile(deps[i]) );
+  }
+  //==================================
+
+
+  //---[ Kernel Signatures ]----------
+  static inline bool isIdentifierChar(const char c){
+    return (('a' <= c) && (c <= 'z')) ||
+      (('A' <= c) && (c <= 'Z')) ||
+      (('0' <= c) && (c <= '9')) ||
+      (c == '_');
+  }
+
+  static inline const char* skipWhitespace(const char *c){
+    while((*c == ' ') || (*c == '\t') || (*c == '\n') || (*c == '\r'))
+      ++c;
+
+    return c;
+  }
+
+  // Names of the occaKernel functions in [source] and the offsets right after them
+  static void findKernels(const std::string &source,
+                          std::vector<std::string> &names,
+                          std::vector<size_t> &nameEnds){
+    const char *c0 = source.c_str();
+    const char *c  = c0;
+
+    while(*c){
+      // Skip comments and literals
+      if((c[0] == '/') && (c[1] == '/')){
+        while(*c && (*c != '\n'))
+          ++c;
+      }
+      else if((c[0] == '/') && (c[1] == '*')){
+        c += 2;
+
+        while(*c && !((c[0] == '*') && (c[1] == '/')))
+          ++c;
+
+        if(*c)
+          c += 2;
+      }
+      else if((*c == '"') || (*c == '\'')){
+        const char quote = *(c++);
+
+        while(*c && (*c != quote)){
+          if((*c == '\\') && c[1])
+            ++c;
+          ++c;
+        }
+
+        if(*c)
+          ++c;
+      }
+      // occaKernel void name(
+      else if(isIdentifierChar(*c)){
+        const char *start = c;
+
+        while(isIdentifierChar(*c))
+          ++c;
+
+        if(((c - start) != 10) || strncmp(start, "occaKernel", 10))
+          continue;
+
+        c = skipWhitespace(c);
+
+        if(strncmp(c, "void", 4) || isIdentifierChar(c[4]))
+          continue;
+
+        c = skipWhitespace(c + 4);
+
+        const char *nameStart = c;
+
+        while(isIdentifierChar(*c))
+          ++c;
+
+        if(c != nameStart){
+          names.push_back(std::string(nameStart, c - nameStart));
+          nameEnds.push_back(c - c0);
+        }
+      }
+      else
+        ++c;
+    }
+  }
+
+  void getKernelNames(const std::string &source,
+                      std::vector<std::string> &names){
+    std::vector<size_t> nameEnds;
+    findKernels(source, names, nameEnds);
+  }
+
+  static std::string stripComments(const std::string &str){
+    std::string ret;
+    const char *c = str.c_str();
+
+    while(*c){
+      if((c[0] == '/') && (c[1] == '/')){
+        while(*c && (*c != '\n'))
+          ++c;
+      }
+      else if((c[0] == '/') && (c[1] == '*')){
+        c += 2;
+
+        while(*c && !((c[0] == '*') && (c[1] == '/')))
+          ++c;
+
+        if(*c)
+          c += 2;
+
+        ret += ' ';
+      }
+      else
+        ret += *(c++);
+    }
+
+    return ret;
+  }
+
+  class kernelParameter {
+  public:
+    std::string name, type;
+    size_t nameStart;
+  };
+
+  // Parameters of the kernel named right before [nameEnd], [bodyStart] is its '{'
+  static bool getKernelParameters(const std::string &source,
+                                  const size_t nameEnd,
+                                  std::vector<kernelParameter> &params,
+                                  size_t &bodyStart){
+    const char *c0 = source.c_str();
+    const char *c  = skipWhitespace(c0 + nameEnd);
+
+    if(*c != '(')
+      return false;
+
+    const char *paramStart = ++c;
+    int depth = 0;
+
+    while(*c){
+      if((c[0] == '/') && (c[1] == '/')){
+        while(*c && (*c != '\n'))
+          ++c;
+        continue;
+      }
+
+      if((c[0] == '/') && (c[1] == '*')){
+        c += 2;
+
+        while(*c && !((c[0] == '*') && (c[1] == '/')))
+          ++c;
+
+        if(*c)
+          c += 2;
+        continue;
+      }
+
+      if((*c == '(') || (*c == '[')){
+        ++depth;
+      }
+      else if((0 < depth) && ((*c == ')') || (*c == ']'))){
+        --depth;
+      }
+      else if((depth == 0) && ((*c == ',') || (*c == ')'))){
+        // The name is the last identifier, declarations ending otherwise are left as is
+        const char *nameEnd_ = c;
+
+        while((paramStart < nameEnd_) &&
+              ((nameEnd_[-1] == ' ') || (nameEnd_[-1] == '\t') ||
+               (nameEnd_[-1] == '\n') || (nameEnd_[-1] == '\r'))){
+          --nameEnd_;
+        }
+
+        const char *nameStart = nameEnd_;
+
+        while((paramStart < nameStart) && isIdentifierChar(nameStart[-1]))
+          --nameStart;
+
+        if(nameStart < nameEnd_){
+          kernelParameter param;
+
+          param.name      = std::string(nameStart, nameEnd_ - nameStart);
+          param.type      = stripComments(std::string(paramStart, nameStart - paramStart));
+          param.nameStart = (nameStart - c0);
+
+          if(param.name != "occaKernelInfoArg")
+            params.push_back(param);
+        }
+
+        if(*c == ')')
+          break;
+
+        paramStart = c + 1;
+      }
+
+      ++c;
+    }
+
+    if(*c != ')')
+      return false;
+
+    while(*c && (*c != '{') && (*c != ';'))
+      ++c;
+
+    if(*c != '{')
+      return false;
+
+    bodyStart = (c - c0);
+
+    return true;
+  }
+
+  bool getKernelArguments(const std::string &source,
+                          const std::string &functionName,
+                          std::vector<std::string> &names,
+                          std::vector<std::string> &types){
+    std::vector<std::string> kernelNames;
+    std::vector<size_t> nameEnds;
+
+    findKernels(source, kernelNames, nameEnds);
+
+    const int kernelCount = kernelNames.size();
+
+    for(int k = 0; k < kernelCount; ++k){
+      std::vector<kernelParameter> params;
+      size_t bodyStart;
+
+      if((kernelNames[k] != functionName) ||
+         !getKernelParameters(source, nameEnds[k], params, bodyStart)){
+        continue;
+      }
+
+      for(size_t i = 0; i < params.size(); ++i){
+        names.push_back(params[i].name);
+        types.push_back(params[i].type);
+      }
+
+      return true;
+    }
+
+    return false;
+  }
+
+  // [type] without qualifiers that only apply to arguments
+  static std::string getLocalType(const std::string &type){
+    std::stringstream ss(type), ret;
+    std::string token;
+
+    ret << "const";
+
+    while(ss >> token){
+      if((token != "const")        &&
+         (token != "occaConst")    &&
+         (token != "occaVariable") &&
+         (token != "&")){
+        ret << ' ' << token;
+      }
+    }
+
+    return ret.str();
+  }
+
+  std::string specializeSource(const std::string &source,
+                               const std::string &specializations){
+    if(specializations.size() == 0)
+      return source;
+
+    std::map<std::string, std::string> values;
+
+    std::stringstream ss(specializations);
+    std::string name, value;
+
+    while(ss >> name && std::getline(ss >> std::ws, value))
+      values[name] = value;
+
+    std::vector<std::string> kernelNames;
+    std::vector<size_t> nameEnds;
+
+    findKernels(source, kernelNames, nameEnds);
+
+    std::string ret = source;
+
+    // Back to front, edits keep the earlier offsets valid
+    for(int k = (kernelNames.size() - 1); 0 <= k; --k){
+      std::vector<kernelParameter> params;
+      size_t bodyStart;
+
+      if(!getKernelParameters(source, nameEnds[k], params, bodyStart))
+        continue;
+
+      std::string constants;
+
+      for(size_t i = 0; i < params.size(); ++i){
+        std::map<std::string, std::string>::iterator it = values.find(params[i].name);
+
+        if(it == values.end())
+          continue;
+
+        constants += ("\n  " + getLocalType(params[i].type) + ' '
+                      + params[i].name + " = " + it->second + ';');
+      }
+
+      if(constants.size() == 0)
+        continue;
+
+      ret.insert(bodyStart + 1, constants);
+
+      // The argument stays to keep the kernel's signature
+      for(int i = (params.size() - 1); 0 <= i; --i){
+        if(values.find(params[i].name) != values.end())
+          ret.insert(params[i].nameStart, "occaUnspecialized_");
+      }
+    }
+
+    return ret;
+  }
+  //==================================
+
+  std::string readFile(const std::string &filename){
+    // Read-only, headers can live in read-only install directories
+    std::ifstream fs(filename.c_str(), std::ios::in | std::ios::binary);
+
+    if(!fs){
+      std::cerr << "Unable to read file " << filename;
+      throw 1;
+    }
+
+    std::stringstream contents;
+    contents << fs.rdbuf();
+
+    return contents.str();
+  }
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+  static const char slashChar = '/';
+#else
+  static const char slashChar = '\\';
+#endif
+
+  // Existing directories are fine
+  static void makeDirectory(const std::string &dir){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    mkdir(dir.c_str(), 0755);
+#else
+    CreateDirectoryA(dir.c_str(), NULL);
+#endif
+  }
+
+  std::string getCachePath(){
+    char *c_cachePath = getenv("OCCA_CACHE_DIR");
+
+    std::string occaCachePath;
+
+    if(c_cachePath == NULL){
+      std::stringstream ss;
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+      char *c_home = getenv("HOME");
+      ss << c_home << "/._occa";
+
+      std::string defaultCacheDir = ss.str();
+      mkdir(defaultCacheDir.c_str(), 0755);
+#else
+      char *c_home = getenv("USERPROFILE");
+
+      ss << c_home << "\\AppData\\Local\\OCCA";
+
+      std::string defaultCacheDir = ss.str();
+      LPCSTR w_defaultCacheDir = defaultCacheDir.c_str();
+      BOOL mkdirStatus = CreateDirectoryA(w_defaultCacheDir, NULL);
+
+      if(mkdirStatus == FALSE)
+        assert(GetLastError() == ERROR_ALREADY_EXISTS);
+
+#  if OCCA_64_BIT
+      ss << "\\amd64";  // use different dir's fro 32 and 64 bit
+#  else
+      ss << "\\x86";    // use different dir's fro 32 and 64 bit
+#  endif
+
+      defaultCacheDir = ss.str();
+
+      w_defaultCacheDir = defaultCacheDir.c_str();
+      mkdirStatus = CreateDirectoryA(w_defaultCacheDir, NULL);
+
+      if(mkdirStatus == FALSE)
+        assert(GetLastError() == ERROR_ALREADY_EXISTS);
+#endif
+      occaCachePath = defaultCacheDir;
+    }
+    else{
+      occaCachePath = c_cachePath;
+      makeDirectory(occaCachePath);
+    }
+
+    const int chars = occaCachePath.size();
+
+    OCCA_CHECK(chars > 0);
+
+    // Take out the pesky //'s
+    int pos = 0;
+
+    for(int i = 0; i < chars; ++i){
+      if(occaCachePath[i] == slashChar)
+        while(i < (chars - 1) && occaCachePath[i + 1] == slashChar)
+          ++i;
+
+      occaCachePath[pos++] = occaCachePath[i];
+    }
+
+    if(occaCachePath[pos - 1] != slashChar){
+      if(pos != chars)
+        occaCachePath[pos] = slashChar;
+      else
+        occaCachePath += slashChar;
+    }
+
+    return occaCachePath;
+  }
+
+  const std::vector<std::string>& getCacheLayers(){
+    static std::vector<std::string> layers;
+    static bool loaded = false;
+
+    if(loaded)
+      return layers;
+
+    loaded = true;
+
+    char *c_layers = getenv("OCCA_SYSTEM_CACHE");
+
+    if(c_layers == NULL)
+      return layers;
+
+    std::stringstream ss(c_layers);
+    std::string layer;
+
+    while(std::getline(ss, layer, ':')){
+      if(layer.size() == 0)
+        continue;
+
+      if(layer[layer.size() - 1] != slashChar)
+        layer += slashChar;
+
+      layers.push_back(layer);
+    }
+
+    return layers;
+  }
+
+  std::string findInCacheLayers(const std::string &entry){
+    const std::vector<std::string> &layers = getCacheLayers();
+    const int layerCount = layers.size();
+
+    for(int i = 0; i < layerCount; ++i){
+      const std::string path = layers[i] + entry;
+
+      // Skip entries a populating job is still writing
+      if(fileExists(path) && !fileExists(getFileLock(path)))
+        return path;
+    }
+
+    return "";
+  }
+
+  std::string getLayeredCachePath(const std::string &cachedFile){
+    const std::string cachePath = getCachePath();
+
+    if(getCacheLayers().empty() ||
+       (cachedFile.compare(0, cachePath.size(), cachePath) != 0)){
+      return cachedFile;
+    }
+
+    const std::string layered = findInCacheLayers(cachedFile.substr(cachePath.size()));
+
+    return (layered.size() ? layered : cachedFile);
+  }
+
+  std::string getMachineFingerprint(){
+    static std::string machineFingerprint;
+
+    // Read once, builds hash it with every tuned kernel
+    if(machineFingerprint.size())
+      return machineFingerprint;
+
+    std::string model;
+    int cores = 0;
+
+#if OCCA_OS == LINUX_OS
+    std::ifstream fs("/proc/cpuinfo");
+    std::string line;
+
+    while(model.empty() && std::getline(fs, line)){
+      if(line.compare(0, 10, "model name") != 0)
+        continue;
+
+      const size_t colon = line.find(':');
+
+      if(colon != std::string::npos)
+        model = line.substr(colon + 1);
+    }
+
+    cores = sysconf(_SC_NPROCESSORS_ONLN);
+#elif OCCA_OS == OSX_OS
+    char brand[256];
+    size_t brandBytes = sizeof(brand);
+
+    if(sysctlbyname("machdep.cpu.brand_string", brand, &brandBytes, NULL, 0) == 0)
+      model = std::string(brand);
+
+    cores = sysconf(_SC_NPROCESSORS_ONLN);
+#else
+    char *c_model = getenv("PROCESSOR_IDENTIFIER");
+    char *c_cores = getenv("NUMBER_OF_PROCESSORS");
+
+    if(c_model != NULL)
+      model = c_model;
+
+    if(c_cores != NULL)
+      cores = atoi(c_cores);
+#endif
+
+    std::stringstream ss(model), fingerprint;
+    std::string word;
+
+    // Collapse the padding some vendors use
+    while(ss >> word)
+      fingerprint << word << ' ';
+
+    fingerprint << '(' << cores << " cores)";
+
+    machineFingerprint = fingerprint.str();
+
+    return machineFingerprint;
+  }
+
+  //---[ Host ISA ]-------------------
+  class cpuFeature {
+  public:
+    const char *name, *flag;
+    bool found;
+  };
+
+  static cpuFeature cpuFeatures[] = {
+    {"sse3"    , "-msse3"    , false},
+    {"ssse3"   , "-mssse3"   , false},
+    {"sse4.1"  , "-msse4.1"  , false},
+    {"sse4.2"  , "-msse4.2"  , false},
+    {"popcnt"  , "-mpopcnt"  , false},
+    {"avx"     , "-mavx"     , false},
+    {"f16c"    , "-mf16c"    , false},
+    {"fma"     , "-mfma"     , false},
+    {"avx2"    , "-mavx2"    , false},
+    {"bmi"     , "-mbmi"     , false},
+    {"bmi2"    , "-mbmi2"    , false},
+    {"avx512f" , "-mavx512f" , false},
+    {"avx512dq", "-mavx512dq", false},
+    {"avx512cd", "-mavx512cd", false},
+    {"avx512bw", "-mavx512bw", false},
+    {"avx512vl", "-mavx512vl", false}
+  };
+
+  static const int cpuFeatureCount = sizeof(cpuFeatures) / sizeof(cpuFeature);
+
+#if OCCA_OS == WINDOWS_OS
+  static bool hasCpuFeature(const std::string &name){
+    for(int i = 0; i < cpuFeatureCount; ++i){
+      if(name == cpuFeatures[i].name)
+        return cpuFeatures[i].found;
+    }
+
+    return false;
+  }
+#endif
+
+#if OCCA_X86_CPU
+  static void cpuid(const unsigned int leaf,
+                    const unsigned int subleaf,
+                    unsigned int regs[4]){
+#  if OCCA_OS == WINDOWS_OS
+    int regs_[4];
+    __cpuidex(regs_, leaf, subleaf);
+
+    for(int i = 0; i < 4; ++i)
+      regs[i] = regs_[i];
+#  else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#  endif
+  }
+
+  // Register state the OS saves on context switches
+  static uint64_t osSavedState(){
+#  if OCCA_OS == WINDOWS_OS
+    return _xgetbv(0);
+#  else
+    unsigned int eax, edx;
+    __asm__ __volatile__ ("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+
+    return (((uint64_t) edx) << 32) | eax;
+#  endif
+  }
+
+  static void findCpuFeatures(){
+    unsigned int regs[4];
+
+    cpuid(0, 0, regs);
+    const unsigned int maxLeaf = regs[0];
+
+    cpuid(1, 0, regs);
+    const unsigned int ecx1 = regs[2];
+
+    unsigned int ebx7 = 0;
+
+    if(7 <= maxLeaf){
+      cpuid(7, 0, regs);
+      ebx7 = regs[1];
+    }
+
+    // AVX needs the OS to save ymm registers, AVX-512 also opmask and zmm
+    const bool osxsave   = (ecx1 & (1 << 27));
+    const uint64_t state = (osxsave ? osSavedState() : 0);
+
+    const bool ymm = ((state & 0x06) == 0x06);
+    const bool zmm = ((state & 0xe6) == 0xe6);
+
+    const bool found[] = {
+      (ecx1 & (1 << 0))  != 0,
+      (ecx1 & (1 << 9))  != 0,
+      (ecx1 & (1 << 19)) != 0,
+      (ecx1 & (1 << 20)) != 0,
+      (ecx1 & (1 << 23)) != 0,
+      ymm && ((ecx1 & (1 << 28)) != 0),
+      ymm && ((ecx1 & (1 << 29)) != 0),
+      ymm && ((ecx1 & (1 << 12)) != 0),
+      ymm && ((ebx7 & (1 << 5))  != 0),
+      (ebx7 & (1 << 3))  != 0,
+      (ebx7 & (1 << 8))  != 0,
+      zmm && ((ebx7 & (1 << 16)) != 0),
+      zmm && ((ebx7 & (1 << 17)) != 0),
+      zmm && ((ebx7 & (1 << 28)) != 0),
+      zmm && ((ebx7 & (1 << 30)) != 0),
+      zmm && ((ebx7 & (1u << 31)) != 0)
+    };
+
+    for(int i = 0; i < cpuFeatureCount; ++i)
+      cpuFeatures[i].found = found[i];
+  }
+#endif
+
+  std::string getCpuIsa(){
+    static std::string isa;
+
+    if(isa.size())
+      return isa;
+
+#if OCCA_X86_CPU
+    findCpuFeatures();
+
+    isa = ((sizeof(void*) == 8) ? "x86_64" : "x86");
+
+    for(int i = 0; i < cpuFeatureCount; ++i){
+      if(cpuFeatures[i].found)
+        isa += std::string(" ") + cpuFeatures[i].name;
+    }
+#elif defined(__aarch64__)
+    isa = "aarch64";
+#elif defined(__powerpc64__)
+    isa = "ppc64";
+#else
+    isa = "unknown";
+#endif
+
+    return isa;
+  }
+
+  std::string getCpuTargetFlags(){
+    getCpuIsa();
+
+#if OCCA_OS == WINDOWS_OS
+    if(hasCpuFeature("avx512f") && hasCpuFeature("avx512bw") &&
+       hasCpuFeature("avx512dq") && hasCpuFeature("avx512vl")){
+      return "/arch:AVX512";
+    }
+
+    if(hasCpuFeature("avx2"))
+      return "/arch:AVX2";
+
+    if(hasCpuFeature("avx"))
+      return "/arch:AVX";
+
+    return "";
+#else
+    std::string flags;
+
+    for(int i = 0; i < cpuFeatureCount; ++i){
+      if(cpuFeatures[i].found)
+        flags += std::string(flags.size() ? " " : "") + cpuFeatures[i].flag;
+    }
+
+    return flags;
+#endif
+  }
+  //==================================
+
+
+  std::string getCachedName(const std::string &filename,
+                            const std::string &salt,
+                            const std::string &mode,
+                            const std::string &compilerFlags){
+    const std::string occaCachePath = getCachePath();
+
+    hasher h;
+
+    // Comments and formatting don't change the key
+    h.update(hashNormalizedFile(filename));
+    h.update(salt);
+
+    // Headers reached from the source or from the kernelInfo header in the salt
+    //   are part of the key, edits to them lead to a new binary
+    std::vector<std::string> deps, depHashes;
+    hashIncludeClosure(filename, salt, compilerFlags, deps, depHashes);
+
+    const int depCount = deps.size();
+
+    for(int i = 0; i < depCount; ++i)
+      h.update(depHashes[i]);
+
+    // Sharded by the first two digits to keep directories small
+    const std::string digest = h.digest();
+    const std::string entry  = (digest.substr(0, 2) + slashChar
+                                + cacheVersion + "_" + digest);
+
+    // Read-only layers are used in place, they are not indexed
+    if(getCacheLayers().size()){
+      std::string layered = findInCacheLayers(entry);
+
+      // OpenMP binaries on Windows end with .dll
+      if(layered.empty()){
+        layered = findInCacheLayers(entry + ".dll");
+
+        if(layered.size())
+          layered = layered.substr(0, layered.size() - 4);
+      }
+
+      if(layered.size()){
+        recordCachedBinary(layered);
+        return layered;
+      }
+    }
+
+    const std::string cachedBinary = occaCachePath + entry;
+
+    recordCachedBinary(cachedBinary);
+
+    // Bundled binaries are loaded from a private copy, the cache is left alone
+    const std::string bundled = getBundledBinary(cachedBinary);
+
+    if(bundled.size())
+      return bundled;
+
+    const std::string shardPath = occaCachePath + digest.substr(0, 2);
+
+    makeDirectory(shardPath);
+
+    touchCacheEntry(cachedBinary, mode, filename);
+
+    // Manifest of the dependencies next to the binary
+    if(depCount && !fileExists(cachedBinary + ".deps")){
+      std::stringstream manifest;
+
+      for(int i = 0; i < depCount; ++i)
+        manifest << depHashes[i] << ' ' << deps[i] << '\n';
+
+      setPendingManifest(cachedBinary, manifest.str());
+    }
+
+    return cachedBinary;
+  }
+
+  std::string createIntermediateSource(const std::string &filename,
+                                       const std::string &cachedBinary,
+                                       const kernelInfo &info,
+                                       const std::string &preludeHeader){
+    std::string prefix, name;
+    getFilePrefixAndName(cachedBinary, prefix, name);
+
+    const std::string iCachedBinary = prefix + "i_" + name;
+
+    std::ofstream fs;
+    fs.open(iCachedBinary.c_str());
+
+    if(preludeHeader.size())
+      fs << "#include \"" << preludeHeader << "\"\n";
+    else
+      fs << info.occaKeywords;
+
+    fs << info.header << specializeSource(readFile(filename), info.specializations);
+
+    fs.close();
+
+    return iCachedBinary;
+  }
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+  // [noPCH] holds "<failures> <time of the last failure>" for a compiler setup
+  //   Builds are retried after a minute, backing off 4x per failure up to a day
+  static const double pchRetrySeconds    = 60;
+  static const double pchMaxRetrySeconds = 24*60*60;
+
+  static int pchFailures(const std::string &noPCH,
+                         bool &retryDue){
+    std::ifstream fs(noPCH.c_str());
+
+    int failures = 0;
+    int64_t lastFailure = 0;
+
+    retryDue = true;
+
+    if(!(fs >> failures >> lastFailure))
+      return 0;
+
+    double delay = pchRetrySeconds;
+
+    for(int i = 1; (i < failures) && (delay < pchMaxRetrySeconds); ++i)
+      delay *= 4;
+
+    if(pchMaxRetrySeconds < delay)
+      delay = pchMaxRetrySeconds;
+
+    retryDue = (lastFailure + delay <= (double) time(NULL));
+
+    return failures;
+  }
+#endif
+
+  std::string getPrecompiledPrelude(const std::string &compilerEnvScript,
+                                    const std::string &compilerCommand,
+                                    const std::string &prelude){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    char *c_pch = getenv("OCCA_PCH");
+
+    if((c_pch != NULL) && (std::string(c_pch) == "0"))
+      return "";
+
+    hasher h;
+    h.update(compilerEnvScript);
+    h.update(compilerCommand);
+    h.update(prelude);
+
+    const std::string header  = getCachePath() + cacheVersion + "_prelude_" + h.digest() + ".hpp";
+    const std::string pch     = header + ".gch";
+    const std::string noPCH   = header + ".nopch"; // Recent failures to make it
+
+    if(fileExists(pch)){
+      touchCacheEntry(pch, "prelude", "");
+      return header;
+    }
+
+    bool retryDue;
+    pchFailures(noPCH, retryDue);
+
+    if(!retryDue)
+      return header;
+
+    if(!haveFile(pch) && waitForFile(pch)){
+      touchCacheEntry(pch, "prelude", "");
+      return header;
+    }
+
+    // Another process failed while we waited
+    const int failures = pchFailures(noPCH, retryDue);
+
+    if(!retryDue){
+      releaseFile(pch);
+      return header;
+    }
+
+    std::ofstream fs(header.c_str());
+    fs << prelude;
+    fs.close();
+
+    std::stringstream command;
+
+    if(compilerEnvScript.size())
+      command << compilerEnvScript << " && ";
+
+    command << compilerCommand
+            << " -x c++-header " << header
+            << " -o "            << pch;
+
+    const std::string &sCommand = command.str();
+
+    std::cout << "Precompiling prelude\n" << sCommand << "\n";
+
+    if(getCompilerBackend().compile(prelude, pch, sCommand)){
+      std::ofstream marker(noPCH.c_str());
+      marker << (failures + 1) << ' ' << (int64_t) time(NULL) << '\n';
+
+      remove(pch.c_str());
+    }
+    else{
+      remove(noPCH.c_str());
+      touchCacheEntry(pch, "prelude", "");
+    }
+
+    releaseFile(pch);
+
+    return header;
+#else
+    return "";
+#endif
+  }
+
+  //---[ File Mapping ]--------------
+  void* mapFile(const std::string &filename,
+                const uintptr_t offset,
+                uintptr_t &bytes,
+                const int flags,
+                void *&mappedPtr,
+                uintptr_t &mappedBytes){
+    struct stat fileInfo;
+
+    if(stat(filename.c_str(), &fileInfo) != 0){
+      std::cout << "Could not find file [" << filename << "] to map.\n";
+      throw 1;
+    }
+
+    const uintptr_t fileBytes = fileInfo.st_size;
+
+    OCCA_CHECK(offset <= fileBytes);
+
+    if(bytes == 0)
+      bytes = (fileBytes - offset);
+
+    OCCA_CHECK((0 < bytes) && ((offset + bytes) <= fileBytes));
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    const bool readOnly    = (flags & mapReadOnly);
+    const bool copyOnWrite = (flags & mapCopyOnWrite);
+
+    const int fd = ::open(filename.c_str(),
+                          (readOnly || copyOnWrite) ? O_RDONLY : O_RDWR);
+
+    if(fd == -1){
+      std::cout << "Could not open file [" << filename << "] to map.\n";
+      throw 1;
+    }
+
+    // mmap offsets must be page-aligned
+    const uintptr_t pageBytes     = ::sysconf(_SC_PAGESIZE);
+    const uintptr_t alignedOffset = offset - (offset % pageBytes);
+
+    mappedBytes = bytes + (offset - alignedOffset);
+
+    mappedPtr = ::mmap(NULL, mappedBytes,
+                       readOnly    ? PROT_READ  : (PROT_READ | PROT_WRITE),
+                       copyOnWrite ? MAP_PRIVATE : MAP_SHARED,
+                       fd, alignedOffset);
+
+    ::close(fd);
+
+    if(mappedPtr == MAP_FAILED){
+      std::cout << "Could not map file [" << filename << "]: " << strerror(errno) << '\n';
+      throw 1;
+    }
+
+    // Hints only, failures are harmless
+    if(flags & mapSequential)
+      ::madvise(mappedPtr, mappedBytes, MADV_SEQUENTIAL);
+    if(flags & mapRandom)
+      ::madvise(mappedPtr, mappedBytes, MADV_RANDOM);
+    if(flags & mapWillNeed)
+      ::madvise(mappedPtr, mappedBytes, MADV_WILLNEED);
+
+    return ((char*) mappedPtr) + (offset - alignedOffset);
+#else
+    // [-] No mapping on Windows yet, read the range instead
+    FILE *fp = fopen(filename.c_str(), "rb");
+
+    if(fp == NULL){
+      std::cout << "Could not open file [" << filename << "] to map.\n";
+      throw 1;
+    }
+
+    mappedBytes = bytes;
+    mappedPtr   = ::malloc(bytes);
+
+    fseek(fp, (long) offset, SEEK_SET);
+    const size_t bytesRead = fread(mappedPtr, 1, bytes, fp);
+    fclose(fp);
+
+    OCCA_CHECK(bytesRead == bytes);
+
+    return mappedPtr;
+#endif
+  }
+
+  void unmapFile(void *mappedPtr,
+                 const uintptr_t mappedBytes){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    ::munmap(mappedPtr, mappedBytes);
+#else
+    ::free(mappedPtr);
+#endif
+  }
+  //==================================
+
+  //---[ Pinned Host Memory ]--------
+  void* pinnedAlloc(const uintptr_t bytes){
+    void *ptr;
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    const uintptr_t pageBytes = ::sysconf(_SC_PAGESIZE);
+
+    if(posix_memalign(&ptr, pageBytes, bytes)){
+      std::cout << "Could not allocate [" << bytes << "] bytes of pinned memory.\n";
+      throw 1;
+    }
+
+    // RLIMIT_MEMLOCK can be small, pageable memory still works
+    ::mlock(ptr, bytes);
+#else
+    ptr = VirtualAlloc(NULL, bytes, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+
+    if(ptr == NULL){
+      std::cout << "Could not allocate [" << bytes << "] bytes of pinned memory.\n";
+      throw 1;
+    }
+
+    VirtualLock(ptr, bytes);
+#endif
+
+    return ptr;
+  }
+
+  void pinnedFree(void *ptr,
+                  const uintptr_t bytes){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    ::munlock(ptr, bytes);
+    ::free(ptr);
+#else
+    VirtualUnlock(ptr, bytes);
+    VirtualFree(ptr, 0, MEM_RELEASE);
+#endif
+  }
+  //==================================
+
+  //---[ Host Memory Helpers ]--------
+  // Below this size the fill stays in cache, streaming stores would only hurt
+  static const uintptr_t streamingFillBytes = (1 << 18);
+
+  static inline void splitRange(const uintptr_t entries,
+                                const int rank, const int count,
+                                uintptr_t &start, uintptr_t &end){
+    const uintptr_t chunk = (entries + count - 1) / count;
+
+    start = rank * chunk;
+    end   = start + chunk;
+
+    if(entries < start) start = entries;
+    if(entries < end)   end   = entries;
+  }
+
+  void memFill(void *ptr_,
+               const void *pattern_,
+               const uintptr_t patternBytes,
+               const uintptr_t bytes,
+               const int rank, const int count){
+    char *ptr           = (char*) ptr_;
+    const char *pattern = (const char*) pattern_;
+
+    // Split on pattern boundaries, the last rank picks up a partial pattern
+    uintptr_t start, end;
+    splitRange(bytes / patternBytes, rank, count, start, end);
+
+    start *= patternBytes;
+    end   *= patternBytes;
+
+    if(rank == (count - 1))
+      end = bytes;
+
+    uintptr_t p = start;
+
+    if(((16 % patternBytes) == 0) &&
+       (streamingFillBytes <= (end - start))){
+      while((p < end) && (((uintptr_t) (ptr + p)) & 15)){
+        ptr[p] = pattern[p % patternBytes];
+        ++p;
+      }
+
+      union {
+        __m128 v;
+        char c[16];
+      } vec;
+
+      // Every 16-byte aligned chunk starts at the same pattern phase
+      for(int i = 0; i < 16; ++i)
+        vec.c[i] = pattern[(p + i) % patternBytes];
+
+      for(; (p + 16) <= end; p += 16)
+        _mm_stream_ps((float*) (ptr + p), vec.v);
+
+      _mm_sfence();
+
+      for(; p < end; ++p)
+        ptr[p] = pattern[p % patternBytes];
+
+      return;
+    }
+
+    // Align to the pattern and copy whole patterns at a time
+    for(; (p < end) && (p % patternBytes); ++p)
+      ptr[p] = pattern[p % patternBytes];
+
+    for(; (p + patternBytes) <= end; p += patternBytes)
+      ::memcpy(ptr + p, pattern, patternBytes);
+
+    for(; p < end; ++p)
+      ptr[p] = pattern[p % patternBytes];
+  }
+
+  template <class TM>
+  static inline void gatherEntries(TM *dest, const TM *src, const int *indices,
+                                   const uintptr_t start, const uintptr_t end){
+    for(uintptr_t i = start; i < end; ++i)
+      dest[i] = src[indices[i]];
+  }
+
+  template <class TM>
+  static inline void scatterEntries(TM *dest, const TM *src, const int *indices,
+                                    const uintptr_t start, const uintptr_t end){
+    for(uintptr_t i = start; i < end; ++i)
+      dest[indices[i]] = src[i];
+  }
+
+  void memGather(void *dest,
+                 const void *src,
+                 const int *indices,
+                 const uintptr_t entryBytes,
+                 const uintptr_t entries,
+                 const int rank, const int count){
+    uintptr_t start, end;
+    splitRange(entries, rank, count, start, end);
+
+    switch(entryBytes){
+    case 1: gatherEntries((uint8_t*)  dest, (const uint8_t*)  src, indices, start, end); break;
+    case 2: gatherEntries((uint16_t*) dest, (const uint16_t*) src, indices, start, end); break;
+    case 4: gatherEntries((uint32_t*) dest, (const uint32_t*) src, indices, start, end); break;
+    case 8: gatherEntries((uint64_t*) dest, (const uint64_t*) src, indices, start, end); break;
+    default:
+      for(uintptr_t i = start; i < end; ++i)
+        ::memcpy(((char*) dest)      + i*entryBytes,
+                 ((const char*) src) + indices[i]*entryBytes,
+                 entryBytes);
+    }
+  }
+
+  void memScatter(void *dest,
+                  const void *src,
+                  const int *indices,
+                  const uintptr_t entryBytes,
+                  const uintptr_t entries,
+                  const int rank, const int count){
+    uintptr_t start, end;
+    splitRange(entries, rank, count, start, end);
+
+    switch(entryBytes){
+    case 1: scatterEntries((uint8_t*)  dest, (const uint8_t*)  src, indices, start, end); break;
+    case 2: scatterEntries((uint16_t*) dest, (const uint16_t*) src, indices, start, end); break;
+    case 4: scatterEntries((uint32_t*) dest, (const uint32_t*) src, indices, start, end); break;
+    case 8: scatterEntries((uint64_t*) dest, (const uint64_t*) src, indices, start, end); break;
+    default:
+      for(uintptr_t i = start; i < end; ++i)
+        ::memcpy(((char*) dest)      + indices[i]*entryBytes,
+                 ((const char*) src) + i*entryBytes,
+                 entryBytes);
+    }
   }
+  //==================================
 };
@@ -0,0 +1,390 @@
+#include "occaTuner.hpp"
+
+namespace occa {
+  //---[ Autotuning ]-----------------
+  tuningSpace::tuningSpace(const int dims_, const dim &global_) :
+    dims(dims_),
+    global(global_),
+    warmup(2),
+    repetitions(10) {}
+
+  void tuningSpace::addInnerDims(const dim &inner){
+    innerDims.push_back(inner);
+  }
+
+  void tuningSpace::setInnerDefines(const std::string &x,
+                                    const std::string &y,
+                                    const std::string &z){
+    innerDefines[0] = x;
+    innerDefines[1] = y;
+    innerDefines[2] = z;
+  }
+
+  void tuningSpace::addCompilerFlags(const std::string &flags){
+    flagSets.push_back(flags);
+  }
+
+  tuningRecord::tuningRecord() :
+    dims(0),
+    seconds(0) {}
+
+  bool tuningRecord::load(const std::string &filename){
+    std::ifstream fs(filename.c_str());
+
+    if(!fs)
+      return false;
+
+    std::string line;
+
+    while(std::getline(fs, line)){
+      std::stringstream ss(line);
+      std::string field;
+
+      ss >> field;
+
+      if(field == "dims")
+        ss >> dims;
+      else if(field == "inner")
+        ss >> inner.x >> inner.y >> inner.z;
+      else if(field == "define"){
+        std::string name, value;
+        ss >> name;
+        std::getline(ss >> std::ws, value);
+
+        defineNames.push_back(name);
+        defineValues.push_back(value);
+      }
+      else if(field == "flags")
+        std::getline(ss >> std::ws, flags);
+      else if(field == "seconds")
+        ss >> seconds;
+    }
+
+    return (0 < dims);
+  }
+
+  void tuningRecord::save(const std::string &filename) const {
+    std::stringstream tmpFilename;
+    tmpFilename << filename << ".tmp." << this;
+
+    std::ofstream fs(tmpFilename.str().c_str());
+
+    fs << "dims "  << dims << '\n'
+       << "inner " << inner.x << ' ' << inner.y << ' ' << inner.z << '\n';
+
+    const int defineCount = defineNames.size();
+
+    for(int i = 0; i < defineCount; ++i)
+      fs << "define " << defineNames[i] << ' ' << defineValues[i] << '\n';
+
+    if(flags.size())
+      fs << "flags " << flags << '\n';
+
+    fs << "seconds " << seconds << '\n';
+
+    fs.close();
+
+    // Readers never see a partial record
+    rename(tmpFilename.str().c_str(), filename.c_str());
+  }
+
+  void tuningRecord::apply(kernelInfo &info) const {
+    const int defineCount = defineNames.size();
+
+    for(int i = 0; i < defineCount; ++i)
+      info.addDefine(defineNames[i], defineValues[i]);
+
+    if(flags.size())
+      info.addCompilerFlag(flags);
+  }
+
+  static std::string getTuningPath(){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    return getCachePath() + "tuning/";
+#else
+    return getCachePath() + "tuning\\";
+#endif
+  }
+
+  std::string device::tuningRecordName(const std::string &filename,
+                                       const std::string &functionName,
+                                       const kernelInfo &info_){
+    std::stringstream ss;
+
+    ss << strMode << ' '
+       << dHandle->setupArgs[0] << ' '
+       << dHandle->setupArgs[1] << '\n'
+       << getMachineFingerprint()    << '\n'
+       << dHandle->compilerEnvScript << '\n'
+       << dHandle->compiler          << '\n'
+       << dHandle->compilerFlags     << '\n'
+       << functionName               << '\n';
+
+    hasher h;
+
+    h.update(ss.str());
+    h.update(hashNormalizedFile(filename));
+    h.update(info_.salt());
+
+    // Winners tuned against older headers don't apply
+    std::vector<std::string> deps, depHashes;
+    hashIncludeClosure(filename, info_.salt(), dHandle->compilerFlags, deps, depHashes);
+
+    const int depCount = deps.size();
+
+    for(int i = 0; i < depCount; ++i)
+      h.update(depHashes[i]);
+
+    return getTuningPath() + cacheVersion + "_" + h.digest();
+  }
+
+  // Lookups are remembered per device, source version, function and kernelInfo
+  //   so repeat builds skip the hashing and the cache layer probes
+  class tuningLookup {
+  public:
+    bool tuned;
+    tuningRecord record;
+  };
+
+  static std::map<std::string, tuningLookup> tuningLookups;
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+  static pthread_mutex_t tuningLookupMutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+  bool device::findTuningRecord(const std::string &filename,
+                                const std::string &functionName,
+                                const kernelInfo &info_,
+                                tuningRecord &tuning){
+    const std::string key = cachedKernelKey(filename, functionName, info_);
+
+    if(key.size()){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+      pthread_mutex_lock(&tuningLookupMutex);
+#endif
+
+      std::map<std::string, tuningLookup>::iterator it = tuningLookups.find(key);
+
+      const bool found = (it != tuningLookups.end());
+
+      if(found)
+        tuning = it->second.record;
+
+      const bool tuned = (found && it->second.tuned);
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+      pthread_mutex_unlock(&tuningLookupMutex);
+#endif
+
+      if(found)
+        return tuned;
+    }
+
+    // Site-wide tuning records in read-only cache layers come first
+    tuningLookup lookup;
+    lookup.tuned = lookup.record.load(getLayeredCachePath(tuningRecordName(filename,
+                                                                           functionName,
+                                                                           info_)));
+    tuning = lookup.record;
+
+    if(key.size()){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+      pthread_mutex_lock(&tuningLookupMutex);
+#endif
+
+      tuningLookups[key] = lookup;
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+      pthread_mutex_unlock(&tuningLookupMutex);
+#endif
+    }
+
+    return lookup.tuned;
+  }
+
+  // A new winner replaces what earlier lookups found
+  static void forgetTuningLookups(){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    pthread_mutex_lock(&tuningLookupMutex);
+#endif
+
+    tuningLookups.clear();
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    pthread_mutex_unlock(&tuningLookupMutex);
+#endif
+  }
+
+  // Candidates for every inner size, flag set and combination of define values
+  static void getCandidates(const tuningSpace &space,
+                            std::vector<tuningRecord> &candidates){
+    const int innerCount  = space.innerDims.size();
+    const int flagCount   = std::max(1, (int) space.flagSets.size());
+    const int defineCount = space.defineNames.size();
+
+    int combinations = 1;
+
+    for(int d = 0; d < defineCount; ++d)
+      combinations *= space.defineValues[d].size();
+
+    for(int i = 0; i < innerCount; ++i){
+      for(int f = 0; f < flagCount; ++f){
+        for(int c = 0; c < combinations; ++c){
+          tuningRecord candidate;
+
+          candidate.dims  = space.dims;
+          candidate.inner = space.innerDims[i];
+
+          if(space.flagSets.size())
+            candidate.flags = space.flagSets[f];
+
+          for(int d = 0; d < space.dims; ++d){
+            if(space.innerDefines[d].size() == 0)
+              continue;
+
+            std::stringstream value;
+            value << candidate.inner[d];
+
+            candidate.defineNames.push_back(space.innerDefines[d]);
+            candidate.defineValues.push_back(value.str());
+          }
+
+          int digits = c;
+
+          for(int d = 0; d < defineCount; ++d){
+            const int values = space.defineValues[d].size();
+
+            candidate.defineNames.push_back(space.defineNames[d]);
+            candidate.defineValues.push_back(space.defineValues[d][digits % values]);
+
+            digits /= values;
+          }
+
+          candidates.push_back(candidate);
+        }
+      }
+    }
+  }
+
+  static std::string describeCandidate(tuningRecord &candidate){
+    std::stringstream ss;
+
+    ss << "inner(" << candidate.inner.x;
+
+    for(int d = 1; d < candidate.dims; ++d)
+      ss << ", " << candidate.inner[d];
+
+    ss << ')';
+
+    const int defineCount = candidate.defineNames.size();
+
+    for(int i = 0; i < defineCount; ++i)
+      ss << " " << candidate.defineNames[i] << '=' << candidate.defineValues[i];
+
+    if(candidate.flags.size())
+      ss << " [" << candidate.flags << ']';
+
+    return ss.str();
+  }
+
+  kernel device::autotuneKernel(const std::string &filename,
+                                const std::string &functionName,
+                                const tuningSpace &space,
+                                const std::vector<kernelArg> &args,
+                                const kernelInfo &info_){
+    if(space.innerDims.size() == 0){
+      std::cout << "Autotuning [" << functionName << "] needs inner dimensions to try\n";
+      throw 1;
+    }
+
+    std::vector<tuningRecord> candidates;
+    getCandidates(space, candidates);
+
+    const int candidateCount = candidates.size();
+    const int argCount       = args.size();
+
+    int best = -1;
+
+    for(int c = 0; c < candidateCount; ++c){
+      tuningRecord &candidate = candidates[c];
+
+      kernelInfo info = info_;
+      candidate.apply(info);
+
+      dim global = space.global;
+      dim outer;
+
+      for(int d = 0; d < space.dims; ++d)
+        outer[d] = (global[d] + candidate.inner[d] - 1) / candidate.inner[d];
+
+      kernel ker;
+
+      ker.mode_   = mode_;
+      ker.strMode = strMode;
+
+      // Candidates that fail to build or launch are skipped
+      try {
+        ker.kHandle      = dHandle->buildKernelFromSource(filename, functionName, info);
+        ker.kHandle->dev = this;
+
+        ker.setWorkingDims(space.dims, candidate.inner, outer);
+
+        ker.clearArgumentList();
+
+        for(int i = 0; i < argCount; ++i)
+          ker.addArgument(i, args[i]);
+
+        for(int r = 0; r < space.warmup; ++r)
+          ker.runFromArguments();
+
+        finish();
+
+        const double start = currentTime();
+
+        for(int r = 0; r < space.repetitions; ++r)
+          ker.runFromArguments();
+
+        finish();
+
+        candidate.seconds = (currentTime() - start) / std::max(1, space.repetitions);
+      }
+      catch(...){
+        std::cout << "Tuning [" << functionName << "] " << describeCandidate(candidate)
+                  << " failed, skipping it\n";
+
+        if(ker.kHandle != NULL)
+          ker.free();
+
+        continue;
+      }
+
+      std::cout << "Tuning [" << functionName << "] " << describeCandidate(candidate)
+                << ": " << candidate.seconds << " s\n";
+
+      ker.free();
+
+      if((best < 0) || (candidate.seconds < candidates[best].seconds))
+        best = c;
+    }
+
+    if(best < 0){
+      std::cout << "No candidate of [" << functionName << "] could be run\n";
+      throw 1;
+    }
+
+    std::cout << "Tuned [" << functionName << "]: " << describeCandidate(candidates[best]) << '\n';
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    mkdir(getTuningPath().c_str(), 0755);
+#else
+    CreateDirectoryA(getTuningPath().c_str(), NULL);
+#endif
+
+    candidates[best].save(tuningRecordName(filename, functionName, info_));
+    forgetTuningLookups();
+
+    // The winner's binary is cached, this picks up the record like later builds
+    return buildKernelFromSource(filename, functionName, info_);
+  }
+  //==================================
+}
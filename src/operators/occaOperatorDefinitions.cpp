@@ -1,37 +1,77 @@
   void kernel::operator() (const kernelArg &arg0){
-    (*kHandle)(arg0);
+    const kernelArg args[] = {arg0};
+
+    kernel_v *launched = launchHandle(args, 1);
+
+    if(launched != NULL)
+      (*launched)(arg0);
   }
 
   void kernel::operator() (const kernelArg &arg0,  const kernelArg &arg1){
-    (*kHandle)(arg0,  arg1);
+    const kernelArg args[] = {arg0,  arg1};
+
+    kernel_v *launched = launchHandle(args, 2);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1);
   }
 
   void kernel::operator() (const kernelArg &arg0,  const kernelArg &arg1,  const kernelArg &arg2){
-    (*kHandle)(arg0,  arg1,  arg2);
+    const kernelArg args[] = {arg0,  arg1,  arg2};
+
+    kernel_v *launched = launchHandle(args, 3);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2);
   }
 
   void kernel::operator() (const kernelArg &arg0,  const kernelArg &arg1,  const kernelArg &arg2, 
                       const kernelArg &arg3){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3};
+
+    kernel_v *launched = launchHandle(args, 4);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3);
   }
 
   void kernel::operator() (const kernelArg &arg0,  const kernelArg &arg1,  const kernelArg &arg2, 
                       const kernelArg &arg3,  const kernelArg &arg4){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4};
+
+    kernel_v *launched = launchHandle(args, 5);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4);
   }
 
   void kernel::operator() (const kernelArg &arg0,  const kernelArg &arg1,  const kernelArg &arg2, 
                       const kernelArg &arg3,  const kernelArg &arg4,  const kernelArg &arg5){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5};
+
+    kernel_v *launched = launchHandle(args, 6);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5);
   }
 
   void kernel::operator() (const kernelArg &arg0,  const kernelArg &arg1,  const kernelArg &arg2, 
                       const kernelArg &arg3,  const kernelArg &arg4,  const kernelArg &arg5, 
                       const kernelArg &arg6){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6};
+
+    kernel_v *launched = launchHandle(args, 7);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6);
   }
@@ -39,7 +79,14 @@
   void kernel::operator() (const kernelArg &arg0,  const kernelArg &arg1,  const kernelArg &arg2, 
                       const kernelArg &arg3,  const kernelArg &arg4,  const kernelArg &arg5, 
                       const kernelArg &arg6,  const kernelArg &arg7){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7};
+
+    kernel_v *launched = launchHandle(args, 8);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7);
   }
@@ -47,7 +94,14 @@
   void kernel::operator() (const kernelArg &arg0,  const kernelArg &arg1,  const kernelArg &arg2, 
                       const kernelArg &arg3,  const kernelArg &arg4,  const kernelArg &arg5, 
                       const kernelArg &arg6,  const kernelArg &arg7,  const kernelArg &arg8){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8};
+
+    kernel_v *launched = launchHandle(args, 9);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8);
   }
@@ -56,7 +110,15 @@
                       const kernelArg &arg3,  const kernelArg &arg4,  const kernelArg &arg5, 
                       const kernelArg &arg6,  const kernelArg &arg7,  const kernelArg &arg8, 
                       const kernelArg &arg9){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9};
+
+    kernel_v *launched = launchHandle(args, 10);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9);
@@ -66,7 +128,15 @@
                       const kernelArg &arg3,  const kernelArg &arg4,  const kernelArg &arg5, 
                       const kernelArg &arg6,  const kernelArg &arg7,  const kernelArg &arg8, 
                       const kernelArg &arg9,  const kernelArg &arg10){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10};
+
+    kernel_v *launched = launchHandle(args, 11);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10);
@@ -76,7 +146,15 @@
                       const kernelArg &arg3,  const kernelArg &arg4,  const kernelArg &arg5, 
                       const kernelArg &arg6,  const kernelArg &arg7,  const kernelArg &arg8, 
                       const kernelArg &arg9,  const kernelArg &arg10,  const kernelArg &arg11){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11};
+
+    kernel_v *launched = launchHandle(args, 12);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11);
@@ -87,7 +165,16 @@
                       const kernelArg &arg6,  const kernelArg &arg7,  const kernelArg &arg8, 
                       const kernelArg &arg9,  const kernelArg &arg10,  const kernelArg &arg11, 
                       const kernelArg &arg12){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12};
+
+    kernel_v *launched = launchHandle(args, 13);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -99,7 +186,16 @@
                       const kernelArg &arg6,  const kernelArg &arg7,  const kernelArg &arg8, 
                       const kernelArg &arg9,  const kernelArg &arg10,  const kernelArg &arg11, 
                       const kernelArg &arg12,  const kernelArg &arg13){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13};
+
+    kernel_v *launched = launchHandle(args, 14);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -111,7 +207,16 @@
                       const kernelArg &arg6,  const kernelArg &arg7,  const kernelArg &arg8, 
                       const kernelArg &arg9,  const kernelArg &arg10,  const kernelArg &arg11, 
                       const kernelArg &arg12,  const kernelArg &arg13,  const kernelArg &arg14){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14};
+
+    kernel_v *launched = launchHandle(args, 15);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -124,7 +229,17 @@
                       const kernelArg &arg9,  const kernelArg &arg10,  const kernelArg &arg11, 
                       const kernelArg &arg12,  const kernelArg &arg13,  const kernelArg &arg14, 
                       const kernelArg &arg15){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15};
+
+    kernel_v *launched = launchHandle(args, 16);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -138,7 +253,17 @@
                       const kernelArg &arg9,  const kernelArg &arg10,  const kernelArg &arg11, 
                       const kernelArg &arg12,  const kernelArg &arg13,  const kernelArg &arg14, 
                       const kernelArg &arg15,  const kernelArg &arg16){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16};
+
+    kernel_v *launched = launchHandle(args, 17);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -152,7 +277,17 @@
                       const kernelArg &arg9,  const kernelArg &arg10,  const kernelArg &arg11, 
                       const kernelArg &arg12,  const kernelArg &arg13,  const kernelArg &arg14, 
                       const kernelArg &arg15,  const kernelArg &arg16,  const kernelArg &arg17){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17};
+
+    kernel_v *launched = launchHandle(args, 18);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -167,7 +302,18 @@
                       const kernelArg &arg12,  const kernelArg &arg13,  const kernelArg &arg14, 
                       const kernelArg &arg15,  const kernelArg &arg16,  const kernelArg &arg17, 
                       const kernelArg &arg18){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18};
+
+    kernel_v *launched = launchHandle(args, 19);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -183,7 +329,18 @@
                       const kernelArg &arg12,  const kernelArg &arg13,  const kernelArg &arg14, 
                       const kernelArg &arg15,  const kernelArg &arg16,  const kernelArg &arg17, 
                       const kernelArg &arg18,  const kernelArg &arg19){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19};
+
+    kernel_v *launched = launchHandle(args, 20);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -199,7 +356,18 @@
                       const kernelArg &arg12,  const kernelArg &arg13,  const kernelArg &arg14, 
                       const kernelArg &arg15,  const kernelArg &arg16,  const kernelArg &arg17, 
                       const kernelArg &arg18,  const kernelArg &arg19,  const kernelArg &arg20){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20};
+
+    kernel_v *launched = launchHandle(args, 21);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -216,7 +384,19 @@
                       const kernelArg &arg15,  const kernelArg &arg16,  const kernelArg &arg17, 
                       const kernelArg &arg18,  const kernelArg &arg19,  const kernelArg &arg20, 
                       const kernelArg &arg21){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21};
+
+    kernel_v *launched = launchHandle(args, 22);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -234,7 +414,19 @@
                       const kernelArg &arg15,  const kernelArg &arg16,  const kernelArg &arg17, 
                       const kernelArg &arg18,  const kernelArg &arg19,  const kernelArg &arg20, 
                       const kernelArg &arg21,  const kernelArg &arg22){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21,  arg22};
+
+    kernel_v *launched = launchHandle(args, 23);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -252,7 +444,19 @@
                       const kernelArg &arg15,  const kernelArg &arg16,  const kernelArg &arg17, 
                       const kernelArg &arg18,  const kernelArg &arg19,  const kernelArg &arg20, 
                       const kernelArg &arg21,  const kernelArg &arg22,  const kernelArg &arg23){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21,  arg22,  arg23};
+
+    kernel_v *launched = launchHandle(args, 24);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -271,7 +475,20 @@
                       const kernelArg &arg18,  const kernelArg &arg19,  const kernelArg &arg20, 
                       const kernelArg &arg21,  const kernelArg &arg22,  const kernelArg &arg23, 
                       const kernelArg &arg24){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21,  arg22,  arg23, 
+                      arg24};
+
+    kernel_v *launched = launchHandle(args, 25);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -291,7 +508,20 @@
                       const kernelArg &arg18,  const kernelArg &arg19,  const kernelArg &arg20, 
                       const kernelArg &arg21,  const kernelArg &arg22,  const kernelArg &arg23, 
                       const kernelArg &arg24,  const kernelArg &arg25){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21,  arg22,  arg23, 
+                      arg24,  arg25};
+
+    kernel_v *launched = launchHandle(args, 26);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -311,7 +541,20 @@
                       const kernelArg &arg18,  const kernelArg &arg19,  const kernelArg &arg20, 
                       const kernelArg &arg21,  const kernelArg &arg22,  const kernelArg &arg23, 
                       const kernelArg &arg24,  const kernelArg &arg25,  const kernelArg &arg26){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21,  arg22,  arg23, 
+                      arg24,  arg25,  arg26};
+
+    kernel_v *launched = launchHandle(args, 27);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -332,7 +575,21 @@
                       const kernelArg &arg21,  const kernelArg &arg22,  const kernelArg &arg23, 
                       const kernelArg &arg24,  const kernelArg &arg25,  const kernelArg &arg26, 
                       const kernelArg &arg27){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21,  arg22,  arg23, 
+                      arg24,  arg25,  arg26, 
+                      arg27};
+
+    kernel_v *launched = launchHandle(args, 28);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -354,7 +611,21 @@
                       const kernelArg &arg21,  const kernelArg &arg22,  const kernelArg &arg23, 
                       const kernelArg &arg24,  const kernelArg &arg25,  const kernelArg &arg26, 
                       const kernelArg &arg27,  const kernelArg &arg28){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21,  arg22,  arg23, 
+                      arg24,  arg25,  arg26, 
+                      arg27,  arg28};
+
+    kernel_v *launched = launchHandle(args, 29);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -376,7 +647,21 @@
                       const kernelArg &arg21,  const kernelArg &arg22,  const kernelArg &arg23, 
                       const kernelArg &arg24,  const kernelArg &arg25,  const kernelArg &arg26, 
                       const kernelArg &arg27,  const kernelArg &arg28,  const kernelArg &arg29){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21,  arg22,  arg23, 
+                      arg24,  arg25,  arg26, 
+                      arg27,  arg28,  arg29};
+
+    kernel_v *launched = launchHandle(args, 30);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -399,7 +684,22 @@
                       const kernelArg &arg24,  const kernelArg &arg25,  const kernelArg &arg26, 
                       const kernelArg &arg27,  const kernelArg &arg28,  const kernelArg &arg29, 
                       const kernelArg &arg30){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21,  arg22,  arg23, 
+                      arg24,  arg25,  arg26, 
+                      arg27,  arg28,  arg29, 
+                      arg30};
+
+    kernel_v *launched = launchHandle(args, 31);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -423,7 +723,22 @@
                       const kernelArg &arg24,  const kernelArg &arg25,  const kernelArg &arg26, 
                       const kernelArg &arg27,  const kernelArg &arg28,  const kernelArg &arg29, 
                       const kernelArg &arg30,  const kernelArg &arg31){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21,  arg22,  arg23, 
+                      arg24,  arg25,  arg26, 
+                      arg27,  arg28,  arg29, 
+                      arg30,  arg31};
+
+    kernel_v *launched = launchHandle(args, 32);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -447,7 +762,22 @@
                       const kernelArg &arg24,  const kernelArg &arg25,  const kernelArg &arg26, 
                       const kernelArg &arg27,  const kernelArg &arg28,  const kernelArg &arg29, 
                       const kernelArg &arg30,  const kernelArg &arg31,  const kernelArg &arg32){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21,  arg22,  arg23, 
+                      arg24,  arg25,  arg26, 
+                      arg27,  arg28,  arg29, 
+                      arg30,  arg31,  arg32};
+
+    kernel_v *launched = launchHandle(args, 33);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -472,7 +802,23 @@
                       const kernelArg &arg27,  const kernelArg &arg28,  const kernelArg &arg29, 
                       const kernelArg &arg30,  const kernelArg &arg31,  const kernelArg &arg32, 
                       const kernelArg &arg33){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21,  arg22,  arg23, 
+                      arg24,  arg25,  arg26, 
+                      arg27,  arg28,  arg29, 
+                      arg30,  arg31,  arg32, 
+                      arg33};
+
+    kernel_v *launched = launchHandle(args, 34);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -498,7 +844,23 @@
                       const kernelArg &arg27,  const kernelArg &arg28,  const kernelArg &arg29, 
                       const kernelArg &arg30,  const kernelArg &arg31,  const kernelArg &arg32, 
                       const kernelArg &arg33,  const kernelArg &arg34){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21,  arg22,  arg23, 
+                      arg24,  arg25,  arg26, 
+                      arg27,  arg28,  arg29, 
+                      arg30,  arg31,  arg32, 
+                      arg33,  arg34};
+
+    kernel_v *launched = launchHandle(args, 35);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -524,7 +886,23 @@
                       const kernelArg &arg27,  const kernelArg &arg28,  const kernelArg &arg29, 
                       const kernelArg &arg30,  const kernelArg &arg31,  const kernelArg &arg32, 
                       const kernelArg &arg33,  const kernelArg &arg34,  const kernelArg &arg35){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21,  arg22,  arg23, 
+                      arg24,  arg25,  arg26, 
+                      arg27,  arg28,  arg29, 
+                      arg30,  arg31,  arg32, 
+                      arg33,  arg34,  arg35};
+
+    kernel_v *launched = launchHandle(args, 36);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -551,7 +929,24 @@
                       const kernelArg &arg30,  const kernelArg &arg31,  const kernelArg &arg32, 
                       const kernelArg &arg33,  const kernelArg &arg34,  const kernelArg &arg35, 
                       const kernelArg &arg36){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21,  arg22,  arg23, 
+                      arg24,  arg25,  arg26, 
+                      arg27,  arg28,  arg29, 
+                      arg30,  arg31,  arg32, 
+                      arg33,  arg34,  arg35, 
+                      arg36};
+
+    kernel_v *launched = launchHandle(args, 37);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -579,7 +974,24 @@
                       const kernelArg &arg30,  const kernelArg &arg31,  const kernelArg &arg32, 
                       const kernelArg &arg33,  const kernelArg &arg34,  const kernelArg &arg35, 
                       const kernelArg &arg36,  const kernelArg &arg37){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21,  arg22,  arg23, 
+                      arg24,  arg25,  arg26, 
+                      arg27,  arg28,  arg29, 
+                      arg30,  arg31,  arg32, 
+                      arg33,  arg34,  arg35, 
+                      arg36,  arg37};
+
+    kernel_v *launched = launchHandle(args, 38);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -607,7 +1019,24 @@
                       const kernelArg &arg30,  const kernelArg &arg31,  const kernelArg &arg32, 
                       const kernelArg &arg33,  const kernelArg &arg34,  const kernelArg &arg35, 
                       const kernelArg &arg36,  const kernelArg &arg37,  const kernelArg &arg38){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21,  arg22,  arg23, 
+                      arg24,  arg25,  arg26, 
+                      arg27,  arg28,  arg29, 
+                      arg30,  arg31,  arg32, 
+                      arg33,  arg34,  arg35, 
+                      arg36,  arg37,  arg38};
+
+    kernel_v *launched = launchHandle(args, 39);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -636,7 +1065,25 @@
                       const kernelArg &arg33,  const kernelArg &arg34,  const kernelArg &arg35, 
                       const kernelArg &arg36,  const kernelArg &arg37,  const kernelArg &arg38, 
                       const kernelArg &arg39){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21,  arg22,  arg23, 
+                      arg24,  arg25,  arg26, 
+                      arg27,  arg28,  arg29, 
+                      arg30,  arg31,  arg32, 
+                      arg33,  arg34,  arg35, 
+                      arg36,  arg37,  arg38, 
+                      arg39};
+
+    kernel_v *launched = launchHandle(args, 40);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -666,7 +1113,25 @@
                       const kernelArg &arg33,  const kernelArg &arg34,  const kernelArg &arg35, 
                       const kernelArg &arg36,  const kernelArg &arg37,  const kernelArg &arg38, 
                       const kernelArg &arg39,  const kernelArg &arg40){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21,  arg22,  arg23, 
+                      arg24,  arg25,  arg26, 
+                      arg27,  arg28,  arg29, 
+                      arg30,  arg31,  arg32, 
+                      arg33,  arg34,  arg35, 
+                      arg36,  arg37,  arg38, 
+                      arg39,  arg40};
+
+    kernel_v *launched = launchHandle(args, 41);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -696,7 +1161,25 @@
                       const kernelArg &arg33,  const kernelArg &arg34,  const kernelArg &arg35, 
                       const kernelArg &arg36,  const kernelArg &arg37,  const kernelArg &arg38, 
                       const kernelArg &arg39,  const kernelArg &arg40,  const kernelArg &arg41){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21,  arg22,  arg23, 
+                      arg24,  arg25,  arg26, 
+                      arg27,  arg28,  arg29, 
+                      arg30,  arg31,  arg32, 
+                      arg33,  arg34,  arg35, 
+                      arg36,  arg37,  arg38, 
+                      arg39,  arg40,  arg41};
+
+    kernel_v *launched = launchHandle(args, 42);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -727,7 +1210,26 @@
                       const kernelArg &arg36,  const kernelArg &arg37,  const kernelArg &arg38, 
                       const kernelArg &arg39,  const kernelArg &arg40,  const kernelArg &arg41, 
                       const kernelArg &arg42){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21,  arg22,  arg23, 
+                      arg24,  arg25,  arg26, 
+                      arg27,  arg28,  arg29, 
+                      arg30,  arg31,  arg32, 
+                      arg33,  arg34,  arg35, 
+                      arg36,  arg37,  arg38, 
+                      arg39,  arg40,  arg41, 
+                      arg42};
+
+    kernel_v *launched = launchHandle(args, 43);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -759,7 +1261,26 @@
                       const kernelArg &arg36,  const kernelArg &arg37,  const kernelArg &arg38, 
                       const kernelArg &arg39,  const kernelArg &arg40,  const kernelArg &arg41, 
                       const kernelArg &arg42,  const kernelArg &arg43){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21,  arg22,  arg23, 
+                      arg24,  arg25,  arg26, 
+                      arg27,  arg28,  arg29, 
+                      arg30,  arg31,  arg32, 
+                      arg33,  arg34,  arg35, 
+                      arg36,  arg37,  arg38, 
+                      arg39,  arg40,  arg41, 
+                      arg42,  arg43};
+
+    kernel_v *launched = launchHandle(args, 44);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -791,7 +1312,26 @@
                       const kernelArg &arg36,  const kernelArg &arg37,  const kernelArg &arg38, 
                       const kernelArg &arg39,  const kernelArg &arg40,  const kernelArg &arg41, 
                       const kernelArg &arg42,  const kernelArg &arg43,  const kernelArg &arg44){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21,  arg22,  arg23, 
+                      arg24,  arg25,  arg26, 
+                      arg27,  arg28,  arg29, 
+                      arg30,  arg31,  arg32, 
+                      arg33,  arg34,  arg35, 
+                      arg36,  arg37,  arg38, 
+                      arg39,  arg40,  arg41, 
+                      arg42,  arg43,  arg44};
+
+    kernel_v *launched = launchHandle(args, 45);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -824,7 +1364,27 @@
                       const kernelArg &arg39,  const kernelArg &arg40,  const kernelArg &arg41, 
                       const kernelArg &arg42,  const kernelArg &arg43,  const kernelArg &arg44, 
                       const kernelArg &arg45){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21,  arg22,  arg23, 
+                      arg24,  arg25,  arg26, 
+                      arg27,  arg28,  arg29, 
+                      arg30,  arg31,  arg32, 
+                      arg33,  arg34,  arg35, 
+                      arg36,  arg37,  arg38, 
+                      arg39,  arg40,  arg41, 
+                      arg42,  arg43,  arg44, 
+                      arg45};
+
+    kernel_v *launched = launchHandle(args, 46);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -858,7 +1418,27 @@
                       const kernelArg &arg39,  const kernelArg &arg40,  const kernelArg &arg41, 
                       const kernelArg &arg42,  const kernelArg &arg43,  const kernelArg &arg44, 
                       const kernelArg &arg45,  const kernelArg &arg46){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21,  arg22,  arg23, 
+                      arg24,  arg25,  arg26, 
+                      arg27,  arg28,  arg29, 
+                      arg30,  arg31,  arg32, 
+                      arg33,  arg34,  arg35, 
+                      arg36,  arg37,  arg38, 
+                      arg39,  arg40,  arg41, 
+                      arg42,  arg43,  arg44, 
+                      arg45,  arg46};
+
+    kernel_v *launched = launchHandle(args, 47);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -892,7 +1472,27 @@
                       const kernelArg &arg39,  const kernelArg &arg40,  const kernelArg &arg41, 
                       const kernelArg &arg42,  const kernelArg &arg43,  const kernelArg &arg44, 
                       const kernelArg &arg45,  const kernelArg &arg46,  const kernelArg &arg47){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21,  arg22,  arg23, 
+                      arg24,  arg25,  arg26, 
+                      arg27,  arg28,  arg29, 
+                      arg30,  arg31,  arg32, 
+                      arg33,  arg34,  arg35, 
+                      arg36,  arg37,  arg38, 
+                      arg39,  arg40,  arg41, 
+                      arg42,  arg43,  arg44, 
+                      arg45,  arg46,  arg47};
+
+    kernel_v *launched = launchHandle(args, 48);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -927,7 +1527,28 @@
                       const kernelArg &arg42,  const kernelArg &arg43,  const kernelArg &arg44, 
                       const kernelArg &arg45,  const kernelArg &arg46,  const kernelArg &arg47, 
                       const kernelArg &arg48){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21,  arg22,  arg23, 
+                      arg24,  arg25,  arg26, 
+                      arg27,  arg28,  arg29, 
+                      arg30,  arg31,  arg32, 
+                      arg33,  arg34,  arg35, 
+                      arg36,  arg37,  arg38, 
+                      arg39,  arg40,  arg41, 
+                      arg42,  arg43,  arg44, 
+                      arg45,  arg46,  arg47, 
+                      arg48};
+
+    kernel_v *launched = launchHandle(args, 49);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -963,7 +1584,28 @@
                       const kernelArg &arg42,  const kernelArg &arg43,  const kernelArg &arg44, 
                       const kernelArg &arg45,  const kernelArg &arg46,  const kernelArg &arg47, 
                       const kernelArg &arg48,  const kernelArg &arg49){
-    (*kHandle)(arg0,  arg1,  arg2, 
+    const kernelArg args[] = {arg0,  arg1,  arg2, 
+                      arg3,  arg4,  arg5, 
+                      arg6,  arg7,  arg8, 
+                      arg9,  arg10,  arg11, 
+                      arg12,  arg13,  arg14, 
+                      arg15,  arg16,  arg17, 
+                      arg18,  arg19,  arg20, 
+                      arg21,  arg22,  arg23, 
+                      arg24,  arg25,  arg26, 
+                      arg27,  arg28,  arg29, 
+                      arg30,  arg31,  arg32, 
+                      arg33,  arg34,  arg35, 
+                      arg36,  arg37,  arg38, 
+                      arg39,  arg40,  arg41, 
+                      arg42,  arg43,  arg44, 
+                      arg45,  arg46,  arg47, 
+                      arg48,  arg49};
+
+    kernel_v *launched = launchHandle(args, 50);
+
+    if(launched != NULL)
+      (*launched)(arg0,  arg1,  arg2, 
                       arg3,  arg4,  arg5, 
                       arg6,  arg7,  arg8, 
                       arg9,  arg10,  arg11, 
@@ -58,8 +58,6 @@
     tmpKernel(occaKernelArgs,
               occaInnerId0, occaInnerId1, occaInnerId2,
               args.args[0].data());
-
-    delete &args;
   }
 
   template <>
@@ -124,8 +122,6 @@
               occaInnerId0, occaInnerId1, occaInnerId2,
               args.args[0].data(),
             args.args[1].data());
-
-    delete &args;
   }
 
   template <>
@@ -192,8 +188,6 @@
               args.args[0].data(),
             args.args[1].data(),
             args.args[2].data());
-
-    delete &args;
   }
 
   template <>
@@ -263,8 +257,6 @@
             args.args[1].data(),
             args.args[2].data(),
             args.args[3].data());
-
-    delete &args;
   }
 
   template <>
@@ -336,8 +328,6 @@
             args.args[2].data(),
             args.args[3].data(),
             args.args[4].data());
-
-    delete &args;
   }
 
   template <>
@@ -411,8 +401,6 @@
             args.args[3].data(),
             args.args[4].data(),
             args.args[5].data());
-
-    delete &args;
   }
 
   template <>
@@ -489,8 +477,6 @@
             args.args[4].data(),
             args.args[5].data(),
             args.args[6].data());
-
-    delete &args;
   }
 
   template <>
@@ -569,8 +555,6 @@
             args.args[5].data(),
             args.args[6].data(),
             args.args[7].data());
-
-    delete &args;
   }
 
   template <>
@@ -651,8 +635,6 @@
             args.args[6].data(),
             args.args[7].data(),
             args.args[8].data());
-
-    delete &args;
   }
 
   template <>
@@ -736,8 +718,6 @@
             args.args[7].data(),
             args.args[8].data(),
             args.args[9].data());
-
-    delete &args;
   }
 
   template <>
@@ -823,8 +803,6 @@
             args.args[8].data(),
             args.args[9].data(),
             args.args[10].data());
-
-    delete &args;
   }
 
   template <>
@@ -912,8 +890,6 @@
             args.args[9].data(),
             args.args[10].data(),
             args.args[11].data());
-
-    delete &args;
   }
 
   template <>
@@ -1004,8 +980,6 @@
             args.args[10].data(),
             args.args[11].data(),
             args.args[12].data());
-
-    delete &args;
   }
 
   template <>
@@ -1098,8 +1072,6 @@
             args.args[11].data(),
             args.args[12].data(),
             args.args[13].data());
-
-    delete &args;
   }
 
   template <>
@@ -1194,8 +1166,6 @@
             args.args[12].data(),
             args.args[13].data(),
             args.args[14].data());
-
-    delete &args;
   }
 
   template <>
@@ -1293,8 +1263,6 @@
             args.args[13].data(),
             args.args[14].data(),
             args.args[15].data());
-
-    delete &args;
   }
 
   template <>
@@ -1394,8 +1362,6 @@
             args.args[14].data(),
             args.args[15].data(),
             args.args[16].data());
-
-    delete &args;
   }
 
   template <>
@@ -1497,8 +1463,6 @@
             args.args[15].data(),
             args.args[16].data(),
             args.args[17].data());
-
-    delete &args;
   }
 
   template <>
@@ -1603,8 +1567,6 @@
             args.args[16].data(),
             args.args[17].data(),
             args.args[18].data());
-
-    delete &args;
   }
 
   template <>
@@ -1711,8 +1673,6 @@
             args.args[17].data(),
             args.args[18].data(),
             args.args[19].data());
-
-    delete &args;
   }
 
   template <>
@@ -1821,8 +1781,6 @@
             args.args[18].data(),
             args.args[19].data(),
             args.args[20].data());
-
-    delete &args;
   }
 
   template <>
@@ -1934,8 +1892,6 @@
             args.args[19].data(),
             args.args[20].data(),
             args.args[21].data());
-
-    delete &args;
   }
 
   template <>
@@ -2049,8 +2005,6 @@
             args.args[20].data(),
             args.args[21].data(),
             args.args[22].data());
-
-    delete &args;
   }
 
   template <>
@@ -2166,8 +2120,6 @@
             args.args[21].data(),
             args.args[22].data(),
             args.args[23].data());
-
-    delete &args;
   }
 
   template <>
@@ -2286,8 +2238,6 @@
             args.args[22].data(),
             args.args[23].data(),
             args.args[24].data());
-
-    delete &args;
   }
 
   template <>
@@ -2408,8 +2358,6 @@
             args.args[23].data(),
             args.args[24].data(),
             args.args[25].data());
-
-    delete &args;
   }
 
   template <>
@@ -2532,8 +2480,6 @@
             args.args[24].data(),
             args.args[25].data(),
             args.args[26].data());
-
-    delete &args;
   }
 
   template <>
@@ -2659,8 +2605,6 @@
             args.args[25].data(),
             args.args[26].data(),
             args.args[27].data());
-
-    delete &args;
   }
 
   template <>
@@ -2788,8 +2732,6 @@
             args.args[26].data(),
             args.args[27].data(),
             args.args[28].data());
-
-    delete &args;
   }
 
   template <>
@@ -2919,8 +2861,6 @@
             args.args[27].data(),
             args.args[28].data(),
             args.args[29].data());
-
-    delete &args;
   }
 
   template <>
@@ -3053,8 +2993,6 @@
             args.args[28].data(),
             args.args[29].data(),
             args.args[30].data());
-
-    delete &args;
   }
 
   template <>
@@ -3189,8 +3127,6 @@
             args.args[29].data(),
             args.args[30].data(),
             args.args[31].data());
-
-    delete &args;
   }
 
   template <>
@@ -3327,8 +3263,6 @@
             args.args[30].data(),
             args.args[31].data(),
             args.args[32].data());
-
-    delete &args;
   }
 
   template <>
@@ -3468,8 +3402,6 @@
             args.args[31].data(),
             args.args[32].data(),
             args.args[33].data());
-
-    delete &args;
   }
 
   template <>
@@ -3611,8 +3543,6 @@
             args.args[32].data(),
             args.args[33].data(),
             args.args[34].data());
-
-    delete &args;
   }
 
   template <>
@@ -3756,8 +3686,6 @@
             args.args[33].data(),
             args.args[34].data(),
             args.args[35].data());
-
-    delete &args;
   }
 
   template <>
@@ -3904,8 +3832,6 @@
             args.args[34].data(),
             args.args[35].data(),
             args.args[36].data());
-
-    delete &args;
   }
 
   template <>
@@ -4054,8 +3980,6 @@
             args.args[35].data(),
             args.args[36].data(),
             args.args[37].data());
-
-    delete &args;
   }
 
   template <>
@@ -4206,8 +4130,6 @@
             args.args[36].data(),
             args.args[37].data(),
             args.args[38].data());
-
-    delete &args;
   }
 
   template <>
@@ -4361,8 +4283,6 @@
             args.args[37].data(),
             args.args[38].data(),
             args.args[39].data());
-
-    delete &args;
   }
 
   template <>
@@ -4518,8 +4438,6 @@
             args.args[38].data(),
             args.args[39].data(),
             args.args[40].data());
-
-    delete &args;
   }
 
   template <>
@@ -4677,8 +4595,6 @@
             args.args[39].data(),
             args.args[40].data(),
             args.args[41].data());
-
-    delete &args;
   }
 
   template <>
@@ -4839,8 +4755,6 @@
             args.args[40].data(),
             args.args[41].data(),
             args.args[42].data());
-
-    delete &args;
   }
 
   template <>
@@ -5003,8 +4917,6 @@
             args.args[41].data(),
             args.args[42].data(),
             args.args[43].data());
-
-    delete &args;
   }
 
   template <>
@@ -5169,8 +5081,6 @@
             args.args[42].data(),
             args.args[43].data(),
             args.args[44].data());
-
-    delete &args;
   }
 
   template <>
@@ -5338,8 +5248,6 @@
             args.args[43].data(),
             args.args[44].data(),
             args.args[45].data());
-
-    delete &args;
   }
 
   template <>
@@ -5509,8 +5417,6 @@
             args.args[44].data(),
             args.args[45].data(),
             args.args[46].data());
-
-    delete &args;
   }
 
   template <>
@@ -5682,8 +5588,6 @@
             args.args[45].data(),
             args.args[46].data(),
             args.args[47].data());
-
-    delete &args;
   }
 
   template <>
@@ -5858,8 +5762,6 @@
             args.args[46].data(),
             args.args[47].data(),
             args.args[48].data());
-
-    delete &args;
   }
 
   template <>
@@ -6036,6 +5938,4 @@
             args.args[47].data(),
             args.args[48].data(),
             args.args[49].data());
-
-    delete &args;
   }
\ No newline at end of file